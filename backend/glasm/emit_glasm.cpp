@@ -6,7 +6,9 @@
 #include <tuple>
 
 #include <shader_compiler/common/div_ceil.h>
+#include <shader_compiler/common/allocation_stats.h>
 #include <shader_compiler/common/settings.h>
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/backend/bindings.h>
 #include <shader_compiler/backend/glasm/emit_glasm.h>
 #include <shader_compiler/backend/glasm/emit_glasm_instructions.h>
@@ -399,6 +401,8 @@ std::string_view GetTessSpacing(TessSpacing spacing) {
 
 std::string EmitGLASM(const Profile& profile, const RuntimeInfo& runtime_info, IR::Program& program,
                       Bindings& bindings) {
+    SHADER_TRACE_SCOPE("EmitGLASM");
+    Allocation::Scope allocation_scope{program.allocation_stats, CompilePhase::Backend};
     EmitContext ctx{program, bindings, profile, runtime_info};
     Precolor(program);
     EmitCode(ctx, program);
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <bit>
 #include <string_view>
 
 #include <shader_compiler/backend/glasm/emit_glasm_instructions.h>
@@ -29,18 +30,24 @@ void GetCbuf(EmitContext& ctx, IR::Inst& inst, const IR::Value& binding, ScalarU
     }
 
     const ScalarU32 idx{ctx.reg_alloc.Consume(binding)};
+    const u32 cbuf_mask{ctx.info.indirect_constant_buffer_mask};
+    const int num_cbufs{std::popcount(cbuf_mask)};
+    int num_visited{};
     for (u32 i = 0; i < Info::MAX_INDIRECT_CBUFS; i++) {
+        if (((cbuf_mask >> i) & 1) == 0) {
+            continue;
+        }
         ctx.Add("SEQ.S.CC RC.x,{},{};"
                 "IF NE.x;"
                 "LDC.{} {},c{}[{}];",
                 idx, i, size, ret, i, offset);
 
-        if (i != Info::MAX_INDIRECT_CBUFS - 1) {
+        if (++num_visited != num_cbufs) {
             ctx.Add("ELSE;");
         }
     }
 
-    for (u32 i = 0; i < Info::MAX_INDIRECT_CBUFS; i++) {
+    for (int i = 0; i < num_cbufs; i++) {
         ctx.Add("ENDIF;");
     }
 }
@@ -73,6 +73,15 @@ void EmitFPAdd64(EmitContext& ctx, IR::Inst& inst, ScalarF64 a, ScalarF64 b) {
     ctx.Add("ADD.F64{} {}.x,{},{};", Precise(inst), ctx.reg_alloc.LongDefine(inst), a, b);
 }
 
+void EmitFPAdd16x2([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] IR::Inst& inst,
+                   [[maybe_unused]] Register a, [[maybe_unused]] Register b) {
+    throw NotImplementedException("GLASM instruction");
+}
+
+void EmitFPAdd32x2(EmitContext& ctx, IR::Inst& inst, Register a, Register b) {
+    ctx.Add("ADD.F{} {}.xy,{},{};", Precise(inst), ctx.reg_alloc.Define(inst), a, b);
+}
+
 void EmitFPFma16([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] IR::Inst& inst,
                  [[maybe_unused]] Register a, [[maybe_unused]] Register b,
                  [[maybe_unused]] Register c) {
@@ -87,6 +96,16 @@ void EmitFPFma64(EmitContext& ctx, IR::Inst& inst, ScalarF64 a, ScalarF64 b, Sca
     ctx.Add("MAD.F64{} {}.x,{},{},{};", Precise(inst), ctx.reg_alloc.LongDefine(inst), a, b, c);
 }
 
+void EmitFPFma16x2([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] IR::Inst& inst,
+                   [[maybe_unused]] Register a, [[maybe_unused]] Register b,
+                   [[maybe_unused]] Register c) {
+    throw NotImplementedException("GLASM instruction");
+}
+
+void EmitFPFma32x2(EmitContext& ctx, IR::Inst& inst, Register a, Register b, Register c) {
+    ctx.Add("MAD.F{} {}.xy,{},{},{};", Precise(inst), ctx.reg_alloc.Define(inst), a, b, c);
+}
+
 void EmitFPMax32(EmitContext& ctx, IR::Inst& inst, ScalarF32 a, ScalarF32 b) {
     ctx.Add("MAX.F {}.x,{},{};", inst, a, b);
 }
@@ -116,6 +135,15 @@ void EmitFPMul64(EmitContext& ctx, IR::Inst& inst, ScalarF64 a, ScalarF64 b) {
     ctx.Add("MUL.F64{} {}.x,{},{};", Precise(inst), ctx.reg_alloc.LongDefine(inst), a, b);
 }
 
+void EmitFPMul16x2([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] IR::Inst& inst,
+                   [[maybe_unused]] Register a, [[maybe_unused]] Register b) {
+    throw NotImplementedException("GLASM instruction");
+}
+
+void EmitFPMul32x2(EmitContext& ctx, IR::Inst& inst, Register a, Register b) {
+    ctx.Add("MUL.F{} {}.xy,{},{};", Precise(inst), ctx.reg_alloc.Define(inst), a, b);
+}
+
 void EmitFPNeg16([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] Register value) {
     throw NotImplementedException("GLASM instruction");
 }
@@ -177,6 +205,14 @@ void EmitFPSaturate64([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] Regist
     throw NotImplementedException("GLASM instruction");
 }
 
+void EmitFPSaturate16x2([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] Register value) {
+    throw NotImplementedException("GLASM instruction");
+}
+
+void EmitFPSaturate32x2(EmitContext& ctx, IR::Inst& inst, Register value) {
+    ctx.Add("MOV.F.SAT {}.xy,{};", inst, value);
+}
+
 void EmitFPClamp16([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] Register value,
                    [[maybe_unused]] Register min_value, [[maybe_unused]] Register max_value) {
     throw NotImplementedException("GLASM instruction");
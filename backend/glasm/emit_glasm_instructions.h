@@ -221,9 +221,13 @@ void EmitFPAbs64(EmitContext& ctx, IR::Inst& inst, ScalarF64 value);
 void EmitFPAdd16(EmitContext& ctx, IR::Inst& inst, Register a, Register b);
 void EmitFPAdd32(EmitContext& ctx, IR::Inst& inst, ScalarF32 a, ScalarF32 b);
 void EmitFPAdd64(EmitContext& ctx, IR::Inst& inst, ScalarF64 a, ScalarF64 b);
+void EmitFPAdd16x2(EmitContext& ctx, IR::Inst& inst, Register a, Register b);
+void EmitFPAdd32x2(EmitContext& ctx, IR::Inst& inst, Register a, Register b);
 void EmitFPFma16(EmitContext& ctx, IR::Inst& inst, Register a, Register b, Register c);
 void EmitFPFma32(EmitContext& ctx, IR::Inst& inst, ScalarF32 a, ScalarF32 b, ScalarF32 c);
 void EmitFPFma64(EmitContext& ctx, IR::Inst& inst, ScalarF64 a, ScalarF64 b, ScalarF64 c);
+void EmitFPFma16x2(EmitContext& ctx, IR::Inst& inst, Register a, Register b, Register c);
+void EmitFPFma32x2(EmitContext& ctx, IR::Inst& inst, Register a, Register b, Register c);
 void EmitFPMax32(EmitContext& ctx, IR::Inst& inst, ScalarF32 a, ScalarF32 b);
 void EmitFPMax64(EmitContext& ctx, IR::Inst& inst, ScalarF64 a, ScalarF64 b);
 void EmitFPMin32(EmitContext& ctx, IR::Inst& inst, ScalarF32 a, ScalarF32 b);
@@ -231,6 +235,8 @@ void EmitFPMin64(EmitContext& ctx, IR::Inst& inst, ScalarF64 a, ScalarF64 b);
 void EmitFPMul16(EmitContext& ctx, IR::Inst& inst, Register a, Register b);
 void EmitFPMul32(EmitContext& ctx, IR::Inst& inst, ScalarF32 a, ScalarF32 b);
 void EmitFPMul64(EmitContext& ctx, IR::Inst& inst, ScalarF64 a, ScalarF64 b);
+void EmitFPMul16x2(EmitContext& ctx, IR::Inst& inst, Register a, Register b);
+void EmitFPMul32x2(EmitContext& ctx, IR::Inst& inst, Register a, Register b);
 void EmitFPNeg16(EmitContext& ctx, Register value);
 void EmitFPNeg32(EmitContext& ctx, IR::Inst& inst, ScalarRegister value);
 void EmitFPNeg64(EmitContext& ctx, IR::Inst& inst, Register value);
@@ -246,6 +252,8 @@ void EmitFPSqrt(EmitContext& ctx, IR::Inst& inst, ScalarF32 value);
 void EmitFPSaturate16(EmitContext& ctx, Register value);
 void EmitFPSaturate32(EmitContext& ctx, IR::Inst& inst, ScalarF32 value);
 void EmitFPSaturate64(EmitContext& ctx, Register value);
+void EmitFPSaturate16x2(EmitContext& ctx, Register value);
+void EmitFPSaturate32x2(EmitContext& ctx, IR::Inst& inst, Register value);
 void EmitFPClamp16(EmitContext& ctx, Register value, Register min_value, Register max_value);
 void EmitFPClamp32(EmitContext& ctx, IR::Inst& inst, ScalarF32 value, ScalarF32 min_value,
                    ScalarF32 max_value);
@@ -323,6 +331,8 @@ void EmitShiftRightArithmetic64(EmitContext& ctx, IR::Inst& inst, ScalarRegister
 void EmitBitwiseAnd32(EmitContext& ctx, IR::Inst& inst, ScalarS32 a, ScalarS32 b);
 void EmitBitwiseOr32(EmitContext& ctx, IR::Inst& inst, ScalarS32 a, ScalarS32 b);
 void EmitBitwiseXor32(EmitContext& ctx, IR::Inst& inst, ScalarS32 a, ScalarS32 b);
+void EmitBitwiseLut32(EmitContext& ctx, IR::Inst& inst, const IR::Value& a, const IR::Value& b,
+                      const IR::Value& c, u32 lut);
 void EmitBitFieldInsert(EmitContext& ctx, IR::Inst& inst, ScalarS32 base, ScalarS32 insert,
                         ScalarS32 offset, ScalarS32 count);
 void EmitBitFieldSExtract(EmitContext& ctx, IR::Inst& inst, ScalarS32 base, ScalarS32 offset,
@@ -376,6 +386,22 @@ void EmitSharedAtomicExchange64(EmitContext& ctx, IR::Inst& inst, ScalarU32 poin
                                 Register value);
 void EmitSharedAtomicExchange32x2(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
                                   Register value);
+void EmitSharedAtomicAggregatedIAdd32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                      ScalarU32 value);
+void EmitSharedAtomicAggregatedSMin32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                      ScalarS32 value);
+void EmitSharedAtomicAggregatedUMin32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                      ScalarU32 value);
+void EmitSharedAtomicAggregatedSMax32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                      ScalarS32 value);
+void EmitSharedAtomicAggregatedUMax32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                      ScalarU32 value);
+void EmitSharedAtomicAggregatedAnd32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                     ScalarU32 value);
+void EmitSharedAtomicAggregatedOr32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                    ScalarU32 value);
+void EmitSharedAtomicAggregatedXor32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                     ScalarU32 value);
 void EmitStorageAtomicIAdd32(EmitContext& ctx, IR::Inst& inst, const IR::Value& binding,
                              ScalarU32 offset, ScalarU32 value);
 void EmitStorageAtomicSMin32(EmitContext& ctx, IR::Inst& inst, const IR::Value& binding,
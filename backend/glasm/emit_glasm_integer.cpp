@@ -1,8 +1,11 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <boost/container/small_vector.hpp>
+
 #include <shader_compiler/backend/glasm/emit_glasm_instructions.h>
 #include <shader_compiler/backend/glasm/glasm_emit_context.h>
+#include <shader_compiler/frontend/ir/lut3.h>
 #include <shader_compiler/frontend/ir/value.h>
 
 namespace Shader::Backend::GLASM {
@@ -152,6 +155,47 @@ void EmitBitwiseXor32(EmitContext& ctx, IR::Inst& inst, ScalarS32 a, ScalarS32 b
     BitwiseLogicalOp(ctx, inst, a, b, "XOR");
 }
 
+void EmitBitwiseLut32(EmitContext& ctx, IR::Inst& inst, const IR::Value& a, const IR::Value& b,
+                      const IR::Value& c, u32 lut) {
+    // Operands are consumed after expanding, so temporaries can't be allocated over them
+    struct Ops {
+        std::string Emit(std::string_view lop, std::string_view operands) {
+            const Register reg{ctx.reg_alloc.AllocReg()};
+            temporaries.push_back(reg);
+            ctx.Add("{}.S {}.x,{};", lop, reg, operands);
+            return fmt::format("{}.x", reg);
+        }
+        std::string And(const std::string& lhs, const std::string& rhs) {
+            return Emit("AND", fmt::format("{},{}", lhs, rhs));
+        }
+        std::string Or(const std::string& lhs, const std::string& rhs) {
+            return Emit("OR", fmt::format("{},{}", lhs, rhs));
+        }
+        std::string Xor(const std::string& lhs, const std::string& rhs) {
+            return Emit("XOR", fmt::format("{},{}", lhs, rhs));
+        }
+        std::string Not(const std::string& value) {
+            return Emit("NOT", value);
+        }
+        std::string Imm(u32 value) {
+            return fmt::format("{}", static_cast<s32>(value));
+        }
+        EmitContext& ctx;
+        boost::container::small_vector<Register, 5> temporaries{};
+    } ops{ctx};
+    const auto operand{[&](const IR::Value& value) {
+        return fmt::format("{}", ScalarS32{ctx.reg_alloc.Peek(value)});
+    }};
+    const std::string result{IR::ApplyLut3(ops, operand(a), operand(b), operand(c), lut)};
+    ctx.Add("MOV.S {}.x,{};", ctx.reg_alloc.Define(inst), result);
+    for (const IR::Value& value : {a, b, c}) {
+        static_cast<void>(ctx.reg_alloc.Consume(value));
+    }
+    for (const Register reg : ops.temporaries) {
+        ctx.reg_alloc.FreeReg(reg);
+    }
+}
+
 void EmitBitFieldInsert(EmitContext& ctx, IR::Inst& inst, ScalarS32 base, ScalarS32 insert,
                         ScalarS32 offset, ScalarS32 count) {
     const Register ret{ctx.reg_alloc.Define(inst)};
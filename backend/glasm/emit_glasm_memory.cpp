@@ -315,6 +315,46 @@ void EmitSharedAtomicExchange32x2([[maybe_unused]] EmitContext& ctx,
     throw NotImplementedException("GLASM instruction");
 }
 
+void EmitSharedAtomicAggregatedIAdd32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                      ScalarU32 value) {
+    EmitSharedAtomicIAdd32(ctx, inst, pointer_offset, value);
+}
+
+void EmitSharedAtomicAggregatedSMin32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                      ScalarS32 value) {
+    EmitSharedAtomicSMin32(ctx, inst, pointer_offset, value);
+}
+
+void EmitSharedAtomicAggregatedUMin32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                      ScalarU32 value) {
+    EmitSharedAtomicUMin32(ctx, inst, pointer_offset, value);
+}
+
+void EmitSharedAtomicAggregatedSMax32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                      ScalarS32 value) {
+    EmitSharedAtomicSMax32(ctx, inst, pointer_offset, value);
+}
+
+void EmitSharedAtomicAggregatedUMax32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                      ScalarU32 value) {
+    EmitSharedAtomicUMax32(ctx, inst, pointer_offset, value);
+}
+
+void EmitSharedAtomicAggregatedAnd32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                     ScalarU32 value) {
+    EmitSharedAtomicAnd32(ctx, inst, pointer_offset, value);
+}
+
+void EmitSharedAtomicAggregatedOr32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                    ScalarU32 value) {
+    EmitSharedAtomicOr32(ctx, inst, pointer_offset, value);
+}
+
+void EmitSharedAtomicAggregatedXor32(EmitContext& ctx, IR::Inst& inst, ScalarU32 pointer_offset,
+                                     ScalarU32 value) {
+    EmitSharedAtomicXor32(ctx, inst, pointer_offset, value);
+}
+
 void EmitStorageAtomicIAdd32(EmitContext& ctx, IR::Inst& inst, const IR::Value& binding,
                              ScalarU32 offset, ScalarU32 value) {
     Atom(ctx, inst, binding, offset, value, "ADD", "U32");
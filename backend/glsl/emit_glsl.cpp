@@ -7,7 +7,9 @@
 #include <type_traits>
 
 #include <shader_compiler/common/div_ceil.h>
+#include <shader_compiler/common/allocation_stats.h>
 #include <shader_compiler/common/settings.h>
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/backend/glsl/emit_glsl.h>
 #include <shader_compiler/backend/glsl/emit_glsl_instructions.h>
 #include <shader_compiler/backend/glsl/glsl_emit_context.h>
@@ -217,6 +219,8 @@ void DefineVariables(const EmitContext& ctx, std::string& header) {
 
 std::string EmitGLSL(const Profile& profile, const RuntimeInfo& runtime_info, IR::Program& program,
                      Bindings& bindings) {
+    SHADER_TRACE_SCOPE("EmitGLSL");
+    Allocation::Scope allocation_scope{program.allocation_stats, CompilePhase::Backend};
     EmitContext ctx{program, bindings, profile, runtime_info};
     Precolor(program);
     EmitCode(ctx, program);
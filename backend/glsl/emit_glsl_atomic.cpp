@@ -20,6 +20,38 @@ void SharedCasFunction(EmitContext& ctx, IR::Inst& inst, std::string_view offset
     ctx.Add(cas_loop, smem, ret, smem, function, smem, value, ret);
 }
 
+void SharedAggregatedFunction(EmitContext& ctx, IR::Inst& inst, std::string_view offset,
+                              std::string_view value, std::string_view operation,
+                              std::string_view combine) {
+    const auto ret{ctx.var_alloc.Define(inst, GlslVarType::U32)};
+    const std::string smem{fmt::format("smem[{}>>2]", offset)};
+    const std::string prefix{fmt::format("subgroupExclusive{}({})", operation, value)};
+    const std::string result{
+        fmt::format(fmt::runtime(combine), "subgroupBroadcastFirst(agg_prev)", prefix)};
+    ctx.Add("if(subgroupAll({}==subgroupBroadcastFirst({}))){{uint agg_total=subgroup{}({});"
+            "uint agg_prev=0u;if(subgroupElect()){{agg_prev=atomic{}({},agg_total);}}{}={};"
+            "}}else{{{}=atomic{}({},{});}}",
+            offset, offset, operation, value, operation, smem, ret, result, ret, operation, smem,
+            value);
+}
+
+void SharedAggregatedCasFunction(EmitContext& ctx, IR::Inst& inst, std::string_view offset,
+                                 std::string_view value, std::string_view operation,
+                                 std::string_view function) {
+    const auto ret{ctx.var_alloc.Define(inst, GlslVarType::U32)};
+    const std::string smem{fmt::format("smem[{}>>2]", offset)};
+    ctx.Add("if(subgroupAll({}==subgroupBroadcastFirst({}))){{"
+            "uint agg_total=uint(subgroup{}(int({})));uint agg_prev=0u;if(subgroupElect()){{",
+            offset, offset, operation, value);
+    ctx.Add(cas_loop, smem, "agg_prev", smem, function, smem, "agg_total", "agg_prev");
+    ctx.Add("}}{}={}(subgroupBroadcastFirst(agg_prev),uint(subgroupExclusive{}(int({}))));"
+            "}}else{{",
+            ret, function, operation, value);
+    const std::string u32_value{fmt::format("uint({})", value)};
+    ctx.Add(cas_loop, smem, ret, smem, function, smem, u32_value, ret);
+    ctx.Add("}}");
+}
+
 void SsboCasFunction(EmitContext& ctx, IR::Inst& inst, const IR::Value& binding,
                      const IR::Value& offset, std::string_view value, std::string_view function) {
     const auto ret{ctx.var_alloc.Define(inst, GlslVarType::U32)};
@@ -112,6 +144,46 @@ void EmitSharedAtomicExchange32x2(EmitContext& ctx, IR::Inst& inst, std::string_
     ctx.Add("smem[{}>>2]={}.x;smem[({}+4)>>2]={}.y;", pointer_offset, value, pointer_offset, value);
 }
 
+void EmitSharedAtomicAggregatedIAdd32(EmitContext& ctx, IR::Inst& inst,
+                                      std::string_view pointer_offset, std::string_view value) {
+    SharedAggregatedFunction(ctx, inst, pointer_offset, value, "Add", "{}+{}");
+}
+
+void EmitSharedAtomicAggregatedSMin32(EmitContext& ctx, IR::Inst& inst,
+                                      std::string_view pointer_offset, std::string_view value) {
+    SharedAggregatedCasFunction(ctx, inst, pointer_offset, value, "Min", "CasMinS32");
+}
+
+void EmitSharedAtomicAggregatedUMin32(EmitContext& ctx, IR::Inst& inst,
+                                      std::string_view pointer_offset, std::string_view value) {
+    SharedAggregatedFunction(ctx, inst, pointer_offset, value, "Min", "min({},{})");
+}
+
+void EmitSharedAtomicAggregatedSMax32(EmitContext& ctx, IR::Inst& inst,
+                                      std::string_view pointer_offset, std::string_view value) {
+    SharedAggregatedCasFunction(ctx, inst, pointer_offset, value, "Max", "CasMaxS32");
+}
+
+void EmitSharedAtomicAggregatedUMax32(EmitContext& ctx, IR::Inst& inst,
+                                      std::string_view pointer_offset, std::string_view value) {
+    SharedAggregatedFunction(ctx, inst, pointer_offset, value, "Max", "max({},{})");
+}
+
+void EmitSharedAtomicAggregatedAnd32(EmitContext& ctx, IR::Inst& inst,
+                                     std::string_view pointer_offset, std::string_view value) {
+    SharedAggregatedFunction(ctx, inst, pointer_offset, value, "And", "{}&{}");
+}
+
+void EmitSharedAtomicAggregatedOr32(EmitContext& ctx, IR::Inst& inst,
+                                    std::string_view pointer_offset, std::string_view value) {
+    SharedAggregatedFunction(ctx, inst, pointer_offset, value, "Or", "{}|{}");
+}
+
+void EmitSharedAtomicAggregatedXor32(EmitContext& ctx, IR::Inst& inst,
+                                     std::string_view pointer_offset, std::string_view value) {
+    SharedAggregatedFunction(ctx, inst, pointer_offset, value, "Xor", "{}^{}");
+}
+
 void EmitStorageAtomicIAdd32(EmitContext& ctx, IR::Inst& inst, const IR::Value& binding,
                              const IR::Value& offset, std::string_view value) {
     ctx.AddU32("{}=atomicAdd({}_ssbo{}[{}>>2],{});", inst, ctx.stage_name, binding.U32(),
@@ -57,6 +57,15 @@ void EmitFPAdd64(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::stri
     }
 }
 
+void EmitFPAdd16x2([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] IR::Inst& inst,
+                   [[maybe_unused]] std::string_view a, [[maybe_unused]] std::string_view b) {
+    NotImplemented();
+}
+
+void EmitFPAdd32x2(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b) {
+    ctx.AddF32x2("{}={}+{};", inst, a, b);
+}
+
 void EmitFPFma16([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] IR::Inst& inst,
                  [[maybe_unused]] std::string_view a, [[maybe_unused]] std::string_view b,
                  [[maybe_unused]] std::string_view c) {
@@ -81,6 +90,17 @@ void EmitFPFma64(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::stri
     }
 }
 
+void EmitFPFma16x2([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] IR::Inst& inst,
+                   [[maybe_unused]] std::string_view a, [[maybe_unused]] std::string_view b,
+                   [[maybe_unused]] std::string_view c) {
+    NotImplemented();
+}
+
+void EmitFPFma32x2(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b,
+                   std::string_view c) {
+    ctx.AddF32x2("{}=fma({},{},{});", inst, a, b, c);
+}
+
 void EmitFPMax32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b) {
     ctx.AddF32("{}=max({},{});", inst, a, b);
 }
@@ -118,6 +138,15 @@ void EmitFPMul64(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::stri
     }
 }
 
+void EmitFPMul16x2([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] IR::Inst& inst,
+                   [[maybe_unused]] std::string_view a, [[maybe_unused]] std::string_view b) {
+    NotImplemented();
+}
+
+void EmitFPMul32x2(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b) {
+    ctx.AddF32x2("{}={}*{};", inst, a, b);
+}
+
 void EmitFPNeg16([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] IR::Inst& inst,
                  [[maybe_unused]] std::string_view value) {
     NotImplemented();
@@ -182,6 +211,15 @@ void EmitFPSaturate64(EmitContext& ctx, IR::Inst& inst, std::string_view value)
     ctx.AddF64("{}=min(max({},0.0),1.0);", inst, value);
 }
 
+void EmitFPSaturate16x2([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] IR::Inst& inst,
+                        [[maybe_unused]] std::string_view value) {
+    NotImplemented();
+}
+
+void EmitFPSaturate32x2(EmitContext& ctx, IR::Inst& inst, std::string_view value) {
+    ctx.AddF32x2("{}=min(max({},0.0),1.0);", inst, value);
+}
+
 void EmitFPClamp16([[maybe_unused]] EmitContext& ctx, [[maybe_unused]] IR::Inst& inst,
                    [[maybe_unused]] std::string_view value,
                    [[maybe_unused]] std::string_view min_value,
@@ -113,6 +113,28 @@ std::string GetOffsetVec(EmitContext& ctx, const IR::Value& offset) {
     }
 }
 
+bool IsDynamicPtp(const IR::Value& offset, const IR::Value& offset2) {
+    if (offset2.IsEmpty()) {
+        return false;
+    }
+    return !offset.InstRecursive()->AreAllArgsImmediates() ||
+           !offset2.InstRecursive()->AreAllArgsImmediates();
+}
+
+/// textureGatherOffsets requires constant offsets, dynamic ones are gathered once per texel from
+/// the footprint at its own offset and the i0j0 texel (the W component) is selected
+std::array<std::string, 4> DynamicPtpOffsets(EmitContext& ctx, const IR::Value& offset,
+                                             const IR::Value& offset2) {
+    const auto offsets{ctx.var_alloc.Consume(offset)};
+    const auto offsets2{ctx.var_alloc.Consume(offset2)};
+    return {
+        fmt::format("ivec2({}.xy)", offsets),
+        fmt::format("ivec2({}.zw)", offsets),
+        fmt::format("ivec2({}.xy)", offsets2),
+        fmt::format("ivec2({}.zw)", offsets2),
+    };
+}
+
 std::string PtpOffsets(const IR::Value& offset, const IR::Value& offset2) {
     const std::array values{offset.InstRecursive(), offset2.InstRecursive()};
     if (!values[0]->AreAllArgsImmediates() || !values[1]->AreAllArgsImmediates()) {
@@ -334,6 +356,25 @@ void EmitImageGather(EmitContext& ctx, IR::Inst& inst, const IR::Value& index,
         LOG_WARNING(Shader_GLSL, "Device does not support sparse texture queries. STUBBING");
         ctx.AddU1("{}=true;", *sparse_inst);
     }
+    if (IsDynamicPtp(offset, offset2) && ctx.profile.support_gl_variable_aoffi) {
+        const auto offsets{DynamicPtpOffsets(ctx, offset, offset2)};
+        const auto gather{[&](size_t i) {
+            return fmt::format("textureGatherOffset({},{},{},int({})).w", texture, coords,
+                               offsets[i], info.gather_component);
+        }};
+        if (sparse_inst && supports_sparse) {
+            // Only residency is taken from the sparse variants, the texel is overwritten below
+            const auto resident{[&](size_t i) {
+                return fmt::format(
+                    "sparseTexelsResidentARB(sparseTextureGatherOffsetARB({},{},{},{},int({})))",
+                    texture, coords, offsets[i], texel, info.gather_component);
+            }};
+            ctx.AddU1("{}={}&&{}&&{}&&{};", *sparse_inst, resident(0), resident(1), resident(2),
+                      resident(3));
+        }
+        ctx.Add("{}=vec4({},{},{},{});", texel, gather(0), gather(1), gather(2), gather(3));
+        return;
+    }
     if (!sparse_inst || !supports_sparse) {
         if (offset.IsEmpty()) {
             ctx.Add("{}=textureGather({},{},int({}));", texel, texture, coords,
@@ -381,6 +422,25 @@ void EmitImageGatherDref(EmitContext& ctx, IR::Inst& inst, const IR::Value& inde
         LOG_WARNING(Shader_GLSL, "Device does not support sparse texture queries. STUBBING");
         ctx.AddU1("{}=true;", *sparse_inst);
     }
+    if (IsDynamicPtp(offset, offset2) && ctx.profile.support_gl_variable_aoffi) {
+        const auto offsets{DynamicPtpOffsets(ctx, offset, offset2)};
+        const auto gather{[&](size_t i) {
+            return fmt::format("textureGatherOffset({},{},{},{}).w", texture, coords, dref,
+                               offsets[i]);
+        }};
+        if (sparse_inst && supports_sparse) {
+            // Only residency is taken from the sparse variants, the texel is overwritten below
+            const auto resident{[&](size_t i) {
+                return fmt::format(
+                    "sparseTexelsResidentARB(sparseTextureGatherOffsetARB({},{},{},{},{}))",
+                    texture, coords, dref, offsets[i], texel);
+            }};
+            ctx.AddU1("{}={}&&{}&&{}&&{};", *sparse_inst, resident(0), resident(1), resident(2),
+                      resident(3));
+        }
+        ctx.Add("{}=vec4({},{},{},{});", texel, gather(0), gather(1), gather(2), gather(3));
+        return;
+    }
     if (!sparse_inst || !supports_sparse) {
         if (offset.IsEmpty()) {
             ctx.Add("{}=textureGather({},{},{});", texel, texture, coords, dref);
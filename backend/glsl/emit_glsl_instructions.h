@@ -255,12 +255,18 @@ void EmitFPAbs64(EmitContext& ctx, IR::Inst& inst, std::string_view value);
 void EmitFPAdd16(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPAdd32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPAdd64(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
+void EmitFPAdd16x2(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
+void EmitFPAdd32x2(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPFma16(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b,
                  std::string_view c);
 void EmitFPFma32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b,
                  std::string_view c);
 void EmitFPFma64(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b,
                  std::string_view c);
+void EmitFPFma16x2(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b,
+                   std::string_view c);
+void EmitFPFma32x2(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b,
+                   std::string_view c);
 void EmitFPMax32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPMax64(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPMin32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
@@ -268,6 +274,8 @@ void EmitFPMin64(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::stri
 void EmitFPMul16(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPMul32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPMul64(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
+void EmitFPMul16x2(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
+void EmitFPMul32x2(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPNeg16(EmitContext& ctx, IR::Inst& inst, std::string_view value);
 void EmitFPNeg32(EmitContext& ctx, IR::Inst& inst, std::string_view value);
 void EmitFPNeg64(EmitContext& ctx, IR::Inst& inst, std::string_view value);
@@ -283,6 +291,8 @@ void EmitFPSqrt(EmitContext& ctx, IR::Inst& inst, std::string_view value);
 void EmitFPSaturate16(EmitContext& ctx, IR::Inst& inst, std::string_view value);
 void EmitFPSaturate32(EmitContext& ctx, IR::Inst& inst, std::string_view value);
 void EmitFPSaturate64(EmitContext& ctx, IR::Inst& inst, std::string_view value);
+void EmitFPSaturate16x2(EmitContext& ctx, IR::Inst& inst, std::string_view value);
+void EmitFPSaturate32x2(EmitContext& ctx, IR::Inst& inst, std::string_view value);
 void EmitFPClamp16(EmitContext& ctx, IR::Inst& inst, std::string_view value,
                    std::string_view min_value, std::string_view max_value);
 void EmitFPClamp32(EmitContext& ctx, IR::Inst& inst, std::string_view value,
@@ -387,6 +397,8 @@ void EmitShiftRightArithmetic64(EmitContext& ctx, IR::Inst& inst, std::string_vi
 void EmitBitwiseAnd32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitBitwiseOr32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitBitwiseXor32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
+void EmitBitwiseLut32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b,
+                      std::string_view c, u32 lut);
 void EmitBitFieldInsert(EmitContext& ctx, IR::Inst& inst, std::string_view base,
                         std::string_view insert, std::string_view offset, std::string_view count);
 void EmitBitFieldSExtract(EmitContext& ctx, IR::Inst& inst, std::string_view base,
@@ -446,6 +458,22 @@ void EmitSharedAtomicExchange64(EmitContext& ctx, IR::Inst& inst, std::string_vi
                                 std::string_view value);
 void EmitSharedAtomicExchange32x2(EmitContext& ctx, IR::Inst& inst, std::string_view pointer_offset,
                                   std::string_view value);
+void EmitSharedAtomicAggregatedIAdd32(EmitContext& ctx, IR::Inst& inst,
+                                      std::string_view pointer_offset, std::string_view value);
+void EmitSharedAtomicAggregatedSMin32(EmitContext& ctx, IR::Inst& inst,
+                                      std::string_view pointer_offset, std::string_view value);
+void EmitSharedAtomicAggregatedUMin32(EmitContext& ctx, IR::Inst& inst,
+                                      std::string_view pointer_offset, std::string_view value);
+void EmitSharedAtomicAggregatedSMax32(EmitContext& ctx, IR::Inst& inst,
+                                      std::string_view pointer_offset, std::string_view value);
+void EmitSharedAtomicAggregatedUMax32(EmitContext& ctx, IR::Inst& inst,
+                                      std::string_view pointer_offset, std::string_view value);
+void EmitSharedAtomicAggregatedAnd32(EmitContext& ctx, IR::Inst& inst,
+                                     std::string_view pointer_offset, std::string_view value);
+void EmitSharedAtomicAggregatedOr32(EmitContext& ctx, IR::Inst& inst,
+                                    std::string_view pointer_offset, std::string_view value);
+void EmitSharedAtomicAggregatedXor32(EmitContext& ctx, IR::Inst& inst,
+                                     std::string_view pointer_offset, std::string_view value);
 void EmitStorageAtomicIAdd32(EmitContext& ctx, IR::Inst& inst, const IR::Value& binding,
                              const IR::Value& offset, std::string_view value);
 void EmitStorageAtomicSMin32(EmitContext& ctx, IR::Inst& inst, const IR::Value& binding,
@@ -3,6 +3,7 @@
 
 #include <shader_compiler/backend/glsl/emit_glsl_instructions.h>
 #include <shader_compiler/backend/glsl/glsl_emit_context.h>
+#include <shader_compiler/frontend/ir/lut3.h>
 #include <shader_compiler/frontend/ir/value.h>
 
 namespace Shader::Backend::GLSL {
@@ -137,6 +138,31 @@ void EmitBitwiseXor32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std:
     BitwiseLogicalOp(ctx, inst, a, b, '^');
 }
 
+void EmitBitwiseLut32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b,
+                      std::string_view c, u32 lut) {
+    // Build a single expression, the driver compiler can pick its own three input operation
+    struct Ops {
+        std::string And(const std::string& lhs, const std::string& rhs) {
+            return fmt::format("({}&{})", lhs, rhs);
+        }
+        std::string Or(const std::string& lhs, const std::string& rhs) {
+            return fmt::format("({}|{})", lhs, rhs);
+        }
+        std::string Xor(const std::string& lhs, const std::string& rhs) {
+            return fmt::format("({}^{})", lhs, rhs);
+        }
+        std::string Not(const std::string& value) {
+            return fmt::format("(~{})", value);
+        }
+        std::string Imm(u32 value) {
+            return fmt::format("{}u", value);
+        }
+    } ops;
+    const std::string expression{
+        IR::ApplyLut3(ops, std::string{a}, std::string{b}, std::string{c}, lut)};
+    ctx.AddU32("{}={};", inst, expression);
+}
+
 void EmitBitFieldInsert(EmitContext& ctx, IR::Inst& inst, std::string_view base,
                         std::string_view insert, std::string_view offset, std::string_view count) {
     ctx.AddU32("{}=bitfieldInsert({},{},int({}),int({}));", inst, base, insert, offset, count);
@@ -407,6 +407,12 @@ void EmitContext::SetupExtensions() {
             header += "#extension GL_NV_shader_thread_shuffle : enable\n";
         }
     }
+    if (info.uses_shared_atomic_aggregation) {
+        header += "#extension GL_KHR_shader_subgroup_basic : enable\n"
+                  "#extension GL_KHR_shader_subgroup_vote : enable\n"
+                  "#extension GL_KHR_shader_subgroup_ballot : enable\n"
+                  "#extension GL_KHR_shader_subgroup_arithmetic : enable\n";
+    }
     if ((info.stores[IR::Attribute::ViewportIndex] || info.stores[IR::Attribute::Layer]) &&
         profile.support_viewport_index_layer_non_geometry && stage != Stage::Geometry) {
         header += "#extension GL_ARB_shader_viewport_layer_array : enable\n";
@@ -452,6 +458,9 @@ void EmitContext::DefineConstantBufferIndirect() {
               "default:";
 
     for (const auto& desc : info.constant_buffer_descriptors) {
+        if (((info.indirect_constant_buffer_mask >> desc.index) & 1) == 0) {
+            continue;
+        }
         header +=
             fmt::format("case {}:return {}_cbuf{}[offset];", desc.index, stage_name, desc.index);
     }
@@ -480,12 +489,8 @@ void EmitContext::DefineGenericOutput(size_t index, u32 invocations) {
     while (element < 4) {
         std::string definition{fmt::format("layout(location={}", index)};
         const u32 remainder{4 - element};
-        const TransformFeedbackVarying* xfb_varying{};
-        const size_t xfb_varying_index{base_index + element};
-        if (xfb_varying_index < runtime_info.xfb_varyings.size()) {
-            xfb_varying = &runtime_info.xfb_varyings[xfb_varying_index];
-            xfb_varying = xfb_varying->components > 0 ? xfb_varying : nullptr;
-        }
+        const TransformFeedbackOutput* const xfb_varying{
+            runtime_info.xfb_layout.Find(static_cast<IR::Attribute>(base_index + element))};
         const u32 num_components{xfb_varying ? xfb_varying->components : remainder};
         if (element > 0) {
             definition += fmt::format(",component={}", element);
@@ -3,13 +3,16 @@
 
 #pragma once
 
+#include <iterator>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 
 #include <shader_compiler/backend/glsl/var_alloc.h>
+#include <shader_compiler/common/allocation_stats.h>
 #include <shader_compiler/stage.h>
 
 namespace Shader {
@@ -50,12 +53,10 @@ public:
         const auto var_def{var_alloc.AddDefine(inst, type)};
         if (var_def.empty()) {
             // skip assigment.
-            code += fmt::format(fmt::runtime(format_str + 3), std::forward<Args>(args)...);
+            Append(format_str + 3, std::forward<Args>(args)...);
         } else {
-            code += fmt::format(fmt::runtime(format_str), var_def, std::forward<Args>(args)...);
+            Append(format_str, var_def, std::forward<Args>(args)...);
         }
-        // TODO: Remove this
-        code += '\n';
     }
 
     template <typename... Args>
@@ -130,9 +131,7 @@ public:
 
     template <typename... Args>
     void Add(const char* format_str, Args&&... args) {
-        code += fmt::format(fmt::runtime(format_str), std::forward<Args>(args)...);
-        // TODO: Remove this
-        code += '\n';
+        Append(format_str, std::forward<Args>(args)...);
     }
 
     std::string header;
@@ -159,6 +158,18 @@ public:
     bool uses_geometry_passthrough{};
 
 private:
+    template <typename... Args>
+    void Append(std::string_view format_str, Args&&... args) {
+        const size_t capacity{code.capacity()};
+        fmt::format_to(std::back_inserter(code), fmt::runtime(format_str),
+                       std::forward<Args>(args)...);
+        // TODO: Remove this
+        code += '\n';
+        if (code.capacity() != capacity) {
+            Allocation::Record(code.capacity());
+        }
+    }
+
     void SetupExtensions();
     void DefineConstantBuffers(Bindings& bindings);
     void DefineConstantBufferIndirect();
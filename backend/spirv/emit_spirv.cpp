@@ -7,7 +7,9 @@
 #include <utility>
 #include <vector>
 
+#include <shader_compiler/common/allocation_stats.h>
 #include <shader_compiler/common/settings.h>
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/backend/spirv/emit_spirv.h>
 #include <shader_compiler/backend/spirv/emit_spirv_instructions.h>
 #include <shader_compiler/backend/spirv/spirv_emit_context.h>
@@ -387,7 +389,7 @@ void SetupSignedNanCapabilities(const Profile& profile, const IR::Program& progr
 }
 
 void SetupTransformFeedbackCapabilities(EmitContext& ctx, Id main_func) {
-    if (ctx.runtime_info.xfb_varyings.empty()) {
+    if (ctx.runtime_info.xfb_layout.Empty()) {
         return;
     }
     ctx.AddCapability(spv::Capability::TransformFeedback);
@@ -438,6 +440,12 @@ void SetupCapabilities(const Profile& profile, const Info& info, EmitContext& ct
             ctx.AddCapability(spv::Capability::GroupNonUniformVote);
         }
     }
+    if (info.uses_shared_atomic_aggregation) {
+        ctx.AddCapability(spv::Capability::GroupNonUniform);
+        ctx.AddCapability(spv::Capability::GroupNonUniformArithmetic);
+        ctx.AddCapability(spv::Capability::GroupNonUniformBallot);
+        ctx.AddCapability(spv::Capability::GroupNonUniformVote);
+    }
     if (info.uses_int64_bit_atomics && profile.support_int64_atomics) {
         ctx.AddCapability(spv::Capability::Int64Atomics);
     }
@@ -483,6 +491,8 @@ void PatchPhiNodes(IR::Program& program, EmitContext& ctx) {
 
 std::vector<u32> EmitSPIRV(const Profile& profile, const RuntimeInfo& runtime_info,
                            IR::Program& program, Bindings& bindings) {
+    SHADER_TRACE_SCOPE("EmitSPIRV");
+    Allocation::Scope allocation_scope{program.allocation_stats, CompilePhase::Backend};
     EmitContext ctx{profile, runtime_info, program, bindings};
     const Id main{DefineMain(ctx, program)};
     DefineEntryPoint(program, ctx, main);
@@ -177,6 +177,38 @@ Id EmitSharedAtomicExchange32x2(EmitContext& ctx, Id offset, Id value) {
     return ctx.OpCompositeConstruct(ctx.U32[2], value_1, value_2);
 }
 
+Id EmitSharedAtomicAggregatedIAdd32(EmitContext& ctx, Id offset, Id value) {
+    return ctx.OpFunctionCall(ctx.U32[1], ctx.aggregated_iadd_shared, offset, value);
+}
+
+Id EmitSharedAtomicAggregatedSMin32(EmitContext& ctx, Id offset, Id value) {
+    return ctx.OpFunctionCall(ctx.U32[1], ctx.aggregated_smin_shared, offset, value);
+}
+
+Id EmitSharedAtomicAggregatedUMin32(EmitContext& ctx, Id offset, Id value) {
+    return ctx.OpFunctionCall(ctx.U32[1], ctx.aggregated_umin_shared, offset, value);
+}
+
+Id EmitSharedAtomicAggregatedSMax32(EmitContext& ctx, Id offset, Id value) {
+    return ctx.OpFunctionCall(ctx.U32[1], ctx.aggregated_smax_shared, offset, value);
+}
+
+Id EmitSharedAtomicAggregatedUMax32(EmitContext& ctx, Id offset, Id value) {
+    return ctx.OpFunctionCall(ctx.U32[1], ctx.aggregated_umax_shared, offset, value);
+}
+
+Id EmitSharedAtomicAggregatedAnd32(EmitContext& ctx, Id offset, Id value) {
+    return ctx.OpFunctionCall(ctx.U32[1], ctx.aggregated_and_shared, offset, value);
+}
+
+Id EmitSharedAtomicAggregatedOr32(EmitContext& ctx, Id offset, Id value) {
+    return ctx.OpFunctionCall(ctx.U32[1], ctx.aggregated_or_shared, offset, value);
+}
+
+Id EmitSharedAtomicAggregatedXor32(EmitContext& ctx, Id offset, Id value) {
+    return ctx.OpFunctionCall(ctx.U32[1], ctx.aggregated_xor_shared, offset, value);
+}
+
 Id EmitStorageAtomicIAdd32(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                            Id value) {
     return StorageAtomicU32(ctx, binding, offset, value, &Sirit::Module::OpAtomicIAdd);
@@ -70,6 +70,14 @@ Id EmitFPAdd64(EmitContext& ctx, IR::Inst* inst, Id a, Id b) {
     return Decorate(ctx, inst, ctx.OpFAdd(ctx.F64[1], a, b));
 }
 
+Id EmitFPAdd16x2(EmitContext& ctx, IR::Inst* inst, Id a, Id b) {
+    return Decorate(ctx, inst, ctx.OpFAdd(ctx.F16[2], a, b));
+}
+
+Id EmitFPAdd32x2(EmitContext& ctx, IR::Inst* inst, Id a, Id b) {
+    return Decorate(ctx, inst, ctx.OpFAdd(ctx.F32[2], a, b));
+}
+
 Id EmitFPFma16(EmitContext& ctx, IR::Inst* inst, Id a, Id b, Id c) {
     return Decorate(ctx, inst, ctx.OpFma(ctx.F16[1], a, b, c));
 }
@@ -82,6 +90,14 @@ Id EmitFPFma64(EmitContext& ctx, IR::Inst* inst, Id a, Id b, Id c) {
     return Decorate(ctx, inst, ctx.OpFma(ctx.F64[1], a, b, c));
 }
 
+Id EmitFPFma16x2(EmitContext& ctx, IR::Inst* inst, Id a, Id b, Id c) {
+    return Decorate(ctx, inst, ctx.OpFma(ctx.F16[2], a, b, c));
+}
+
+Id EmitFPFma32x2(EmitContext& ctx, IR::Inst* inst, Id a, Id b, Id c) {
+    return Decorate(ctx, inst, ctx.OpFma(ctx.F32[2], a, b, c));
+}
+
 Id EmitFPMax32(EmitContext& ctx, Id a, Id b) {
     return ctx.OpFMax(ctx.F32[1], a, b);
 }
@@ -110,6 +126,14 @@ Id EmitFPMul64(EmitContext& ctx, IR::Inst* inst, Id a, Id b) {
     return Decorate(ctx, inst, ctx.OpFMul(ctx.F64[1], a, b));
 }
 
+Id EmitFPMul16x2(EmitContext& ctx, IR::Inst* inst, Id a, Id b) {
+    return Decorate(ctx, inst, ctx.OpFMul(ctx.F16[2], a, b));
+}
+
+Id EmitFPMul32x2(EmitContext& ctx, IR::Inst* inst, Id a, Id b) {
+    return Decorate(ctx, inst, ctx.OpFMul(ctx.F32[2], a, b));
+}
+
 Id EmitFPNeg16(EmitContext& ctx, Id value) {
     return ctx.OpFNegate(ctx.F16[1], value);
 }
@@ -176,6 +200,20 @@ Id EmitFPSaturate64(EmitContext& ctx, Id value) {
     return Clamp(ctx, ctx.F64[1], value, zero, one);
 }
 
+Id EmitFPSaturate16x2(EmitContext& ctx, Id value) {
+    const Id zero{ctx.Constant(ctx.F16[1], u16{0})};
+    const Id one{ctx.Constant(ctx.F16[1], u16{0x3c00})};
+    return Clamp(ctx, ctx.F16[2], value, ctx.ConstantComposite(ctx.F16[2], zero, zero),
+                 ctx.ConstantComposite(ctx.F16[2], one, one));
+}
+
+Id EmitFPSaturate32x2(EmitContext& ctx, Id value) {
+    const Id zero{ctx.Const(f32{0.0})};
+    const Id one{ctx.Const(f32{1.0})};
+    return Clamp(ctx, ctx.F32[2], value, ctx.ConstantComposite(ctx.F32[2], zero, zero),
+                 ctx.ConstantComposite(ctx.F32[2], one, one));
+}
+
 Id EmitFPClamp16(EmitContext& ctx, Id value, Id min_value, Id max_value) {
     return Clamp(ctx, ctx.F16[1], value, min_value, max_value);
 }
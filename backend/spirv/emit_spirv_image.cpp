@@ -40,8 +40,7 @@ public:
         }
         const std::array values{offset.InstRecursive(), offset2.InstRecursive()};
         if (!values[0]->AreAllArgsImmediates() || !values[1]->AreAllArgsImmediates()) {
-            LOG_WARNING(Shader_SPIRV, "Not all arguments in PTP are immediate, ignoring");
-            return;
+            throw LogicError("Dynamic PTP offsets must be emitted with EmitDynamicPtp");
         }
         const IR::Opcode opcode{values[0]->GetOpcode()};
         if (opcode != values[1]->GetOpcode() || opcode != IR::Opcode::CompositeConstructU32x4) {
@@ -226,6 +225,54 @@ Id Emit(MethodPtrType sparse_ptr, MethodPtrType non_sparse_ptr, EmitContext& ctx
     return ctx.OpCompositeExtract(result_type, sample, 1U);
 }
 
+bool IsDynamicPtp(const IR::Value& offset, const IR::Value& offset2) {
+    if (offset2.IsEmpty()) {
+        return false;
+    }
+    return !offset.InstRecursive()->AreAllArgsImmediates() ||
+           !offset2.InstRecursive()->AreAllArgsImmediates();
+}
+
+/// Gathers with per-texel offsets that aren't known at compile time, ConstOffsets requires
+/// constants so every texel is gathered from the footprint at its own offset and its i0j0 texel
+/// (the W component) is selected, matching the semantics of textureGatherOffsets
+template <typename MethodPtrType>
+Id EmitDynamicPtp(MethodPtrType sparse_ptr, MethodPtrType non_sparse_ptr, EmitContext& ctx,
+                  IR::Inst* inst, Id texture, Id coords, Id component_or_dref,
+                  const IR::Value& offset, const IR::Value& offset2) {
+    IR::Inst* const sparse{inst->GetAssociatedPseudoOperation(IR::Opcode::GetSparseFromOp)};
+    const std::array packed_offsets{ctx.Def(offset), ctx.Def(offset2)};
+    std::array<Id, 4> texels;
+    Id resident{};
+    for (u32 texel = 0; texel < 4; ++texel) {
+        const Id packed{packed_offsets[texel / 2]};
+        const u32 element{(texel % 2) * 2};
+        const Id texel_offset{ctx.OpCompositeConstruct(
+            ctx.U32[2], ctx.OpCompositeExtract(ctx.U32[1], packed, element),
+            ctx.OpCompositeExtract(ctx.U32[1], packed, element + 1))};
+        const ImageOperands operands(texel_offset, Id{}, Id{});
+        if (!sparse) {
+            const Id sample{(ctx.*non_sparse_ptr)(ctx.F32[4], texture, coords, component_or_dref,
+                                                  operands.MaskOptional(), operands.Span())};
+            texels[texel] = ctx.OpCompositeExtract(ctx.F32[1], Decorate(ctx, inst, sample), 3U);
+            continue;
+        }
+        const Id struct_type{ctx.TypeStruct(ctx.U32[1], ctx.F32[4])};
+        const Id sample{(ctx.*sparse_ptr)(struct_type, texture, coords, component_or_dref,
+                                          operands.MaskOptional(), operands.Span())};
+        Decorate(ctx, inst, sample);
+        const Id resident_code{ctx.OpCompositeExtract(ctx.U32[1], sample, 0U)};
+        const Id texel_resident{ctx.OpImageSparseTexelsResident(ctx.U1, resident_code)};
+        resident = texel == 0 ? texel_resident : ctx.OpLogicalAnd(ctx.U1, resident, texel_resident);
+        texels[texel] = ctx.OpCompositeExtract(ctx.F32[1], sample, 1U, 3U);
+    }
+    if (sparse) {
+        sparse->SetDefinition(resident);
+        sparse->Invalidate();
+    }
+    return ctx.OpCompositeConstruct(ctx.F32[4], std::span<const Id>{texels});
+}
+
 Id IsScaled(EmitContext& ctx, const IR::Value& index, Id member_index, u32 base_index) {
     const Id push_constant_u32{ctx.TypePointer(spv::StorageClass::PushConstant, ctx.U32[1])};
     Id bit{};
@@ -416,6 +463,11 @@ Id EmitImageSampleDrefExplicitLod(EmitContext& ctx, IR::Inst* inst, const IR::Va
 Id EmitImageGather(EmitContext& ctx, IR::Inst* inst, const IR::Value& index, Id coords,
                    const IR::Value& offset, const IR::Value& offset2) {
     const auto info{inst->Flags<IR::TextureInstInfo>()};
+    if (IsDynamicPtp(offset, offset2)) {
+        return EmitDynamicPtp(&EmitContext::OpImageSparseGather, &EmitContext::OpImageGather, ctx,
+                              inst, Texture(ctx, info, index), coords,
+                              ctx.Const(info.gather_component), offset, offset2);
+    }
     const ImageOperands operands(ctx, offset, offset2);
     return Emit(&EmitContext::OpImageSparseGather, &EmitContext::OpImageGather, ctx, inst,
                 ctx.F32[4], Texture(ctx, info, index), coords, ctx.Const(info.gather_component),
@@ -425,6 +477,11 @@ Id EmitImageGather(EmitContext& ctx, IR::Inst* inst, const IR::Value& index, Id
 Id EmitImageGatherDref(EmitContext& ctx, IR::Inst* inst, const IR::Value& index, Id coords,
                        const IR::Value& offset, const IR::Value& offset2, Id dref) {
     const auto info{inst->Flags<IR::TextureInstInfo>()};
+    if (IsDynamicPtp(offset, offset2)) {
+        return EmitDynamicPtp(&EmitContext::OpImageSparseDrefGather,
+                              &EmitContext::OpImageDrefGather, ctx, inst,
+                              Texture(ctx, info, index), coords, dref, offset, offset2);
+    }
     const ImageOperands operands(ctx, offset, offset2);
     return Emit(&EmitContext::OpImageSparseDrefGather, &EmitContext::OpImageDrefGather, ctx, inst,
                 ctx.F32[4], Texture(ctx, info, index), coords, dref, operands.MaskOptional(),
@@ -203,9 +203,13 @@ Id EmitFPAbs64(EmitContext& ctx, Id value);
 Id EmitFPAdd16(EmitContext& ctx, IR::Inst* inst, Id a, Id b);
 Id EmitFPAdd32(EmitContext& ctx, IR::Inst* inst, Id a, Id b);
 Id EmitFPAdd64(EmitContext& ctx, IR::Inst* inst, Id a, Id b);
+Id EmitFPAdd16x2(EmitContext& ctx, IR::Inst* inst, Id a, Id b);
+Id EmitFPAdd32x2(EmitContext& ctx, IR::Inst* inst, Id a, Id b);
 Id EmitFPFma16(EmitContext& ctx, IR::Inst* inst, Id a, Id b, Id c);
 Id EmitFPFma32(EmitContext& ctx, IR::Inst* inst, Id a, Id b, Id c);
 Id EmitFPFma64(EmitContext& ctx, IR::Inst* inst, Id a, Id b, Id c);
+Id EmitFPFma16x2(EmitContext& ctx, IR::Inst* inst, Id a, Id b, Id c);
+Id EmitFPFma32x2(EmitContext& ctx, IR::Inst* inst, Id a, Id b, Id c);
 Id EmitFPMax32(EmitContext& ctx, Id a, Id b);
 Id EmitFPMax64(EmitContext& ctx, Id a, Id b);
 Id EmitFPMin32(EmitContext& ctx, Id a, Id b);
@@ -213,6 +217,8 @@ Id EmitFPMin64(EmitContext& ctx, Id a, Id b);
 Id EmitFPMul16(EmitContext& ctx, IR::Inst* inst, Id a, Id b);
 Id EmitFPMul32(EmitContext& ctx, IR::Inst* inst, Id a, Id b);
 Id EmitFPMul64(EmitContext& ctx, IR::Inst* inst, Id a, Id b);
+Id EmitFPMul16x2(EmitContext& ctx, IR::Inst* inst, Id a, Id b);
+Id EmitFPMul32x2(EmitContext& ctx, IR::Inst* inst, Id a, Id b);
 Id EmitFPNeg16(EmitContext& ctx, Id value);
 Id EmitFPNeg32(EmitContext& ctx, Id value);
 Id EmitFPNeg64(EmitContext& ctx, Id value);
@@ -228,6 +234,8 @@ Id EmitFPSqrt(EmitContext& ctx, Id value);
 Id EmitFPSaturate16(EmitContext& ctx, Id value);
 Id EmitFPSaturate32(EmitContext& ctx, Id value);
 Id EmitFPSaturate64(EmitContext& ctx, Id value);
+Id EmitFPSaturate16x2(EmitContext& ctx, Id value);
+Id EmitFPSaturate32x2(EmitContext& ctx, Id value);
 Id EmitFPClamp16(EmitContext& ctx, Id value, Id min_value, Id max_value);
 Id EmitFPClamp32(EmitContext& ctx, Id value, Id min_value, Id max_value);
 Id EmitFPClamp64(EmitContext& ctx, Id value, Id min_value, Id max_value);
@@ -301,6 +309,7 @@ Id EmitShiftRightArithmetic64(EmitContext& ctx, Id base, Id shift);
 Id EmitBitwiseAnd32(EmitContext& ctx, IR::Inst* inst, Id a, Id b);
 Id EmitBitwiseOr32(EmitContext& ctx, IR::Inst* inst, Id a, Id b);
 Id EmitBitwiseXor32(EmitContext& ctx, IR::Inst* inst, Id a, Id b);
+Id EmitBitwiseLut32(EmitContext& ctx, Id a, Id b, Id c, u32 lut);
 Id EmitBitFieldInsert(EmitContext& ctx, Id base, Id insert, Id offset, Id count);
 Id EmitBitFieldSExtract(EmitContext& ctx, IR::Inst* inst, Id base, Id offset, Id count);
 Id EmitBitFieldUExtract(EmitContext& ctx, IR::Inst* inst, Id base, Id offset, Id count);
@@ -338,6 +347,14 @@ Id EmitSharedAtomicXor32(EmitContext& ctx, Id pointer_offset, Id value);
 Id EmitSharedAtomicExchange32(EmitContext& ctx, Id pointer_offset, Id value);
 Id EmitSharedAtomicExchange64(EmitContext& ctx, Id pointer_offset, Id value);
 Id EmitSharedAtomicExchange32x2(EmitContext& ctx, Id pointer_offset, Id value);
+Id EmitSharedAtomicAggregatedIAdd32(EmitContext& ctx, Id pointer_offset, Id value);
+Id EmitSharedAtomicAggregatedSMin32(EmitContext& ctx, Id pointer_offset, Id value);
+Id EmitSharedAtomicAggregatedUMin32(EmitContext& ctx, Id pointer_offset, Id value);
+Id EmitSharedAtomicAggregatedSMax32(EmitContext& ctx, Id pointer_offset, Id value);
+Id EmitSharedAtomicAggregatedUMax32(EmitContext& ctx, Id pointer_offset, Id value);
+Id EmitSharedAtomicAggregatedAnd32(EmitContext& ctx, Id pointer_offset, Id value);
+Id EmitSharedAtomicAggregatedOr32(EmitContext& ctx, Id pointer_offset, Id value);
+Id EmitSharedAtomicAggregatedXor32(EmitContext& ctx, Id pointer_offset, Id value);
 Id EmitStorageAtomicIAdd32(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
                            Id value);
 Id EmitStorageAtomicSMin32(EmitContext& ctx, const IR::Value& binding, const IR::Value& offset,
@@ -3,6 +3,7 @@
 
 #include <shader_compiler/backend/spirv/emit_spirv_instructions.h>
 #include <shader_compiler/backend/spirv/spirv_emit_context.h>
+#include <shader_compiler/frontend/ir/lut3.h>
 
 namespace Shader::Backend::SPIRV {
 namespace {
@@ -136,6 +137,28 @@ Id EmitBitwiseXor32(EmitContext& ctx, IR::Inst* inst, Id a, Id b) {
     return result;
 }
 
+Id EmitBitwiseLut32(EmitContext& ctx, Id a, Id b, Id c, u32 lut) {
+    struct Ops {
+        Id And(Id lhs, Id rhs) {
+            return ctx.OpBitwiseAnd(ctx.U32[1], lhs, rhs);
+        }
+        Id Or(Id lhs, Id rhs) {
+            return ctx.OpBitwiseOr(ctx.U32[1], lhs, rhs);
+        }
+        Id Xor(Id lhs, Id rhs) {
+            return ctx.OpBitwiseXor(ctx.U32[1], lhs, rhs);
+        }
+        Id Not(Id value) {
+            return ctx.OpNot(ctx.U32[1], value);
+        }
+        Id Imm(u32 value) {
+            return ctx.Const(value);
+        }
+        EmitContext& ctx;
+    } ops{ctx};
+    return IR::ApplyLut3(ops, a, b, c, lut);
+}
+
 Id EmitBitFieldInsert(EmitContext& ctx, Id base, Id insert, Id offset, Id count) {
     return ctx.OpBitFieldInsert(ctx.U32[1], base, insert, offset, count);
 }
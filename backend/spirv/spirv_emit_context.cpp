@@ -5,6 +5,7 @@
 #include <array>
 #include <bit>
 #include <climits>
+#include <span>
 
 #include <boost/container/static_vector.hpp>
 
@@ -25,6 +26,17 @@ enum class Operation {
     FPMax,
 };
 
+enum class AggregateOperation {
+    IAdd,
+    SMin,
+    UMin,
+    SMax,
+    UMax,
+    And,
+    Or,
+    Xor,
+};
+
 Id ImageType(EmitContext& ctx, const TextureDescriptor& desc) {
     const spv::ImageFormat format{spv::ImageFormat::Unknown};
     const Id type{ctx.F32[1]};
@@ -157,12 +169,8 @@ void DefineGenericOutput(EmitContext& ctx, size_t index, std::optional<u32> invo
     u32 element{0};
     while (element < 4) {
         const u32 remainder{4 - element};
-        const TransformFeedbackVarying* xfb_varying{};
-        const size_t xfb_varying_index{base_attr_index + element};
-        if (xfb_varying_index < ctx.runtime_info.xfb_varyings.size()) {
-            xfb_varying = &ctx.runtime_info.xfb_varyings[xfb_varying_index];
-            xfb_varying = xfb_varying->components > 0 ? xfb_varying : nullptr;
-        }
+        const TransformFeedbackOutput* const xfb_varying{
+            ctx.runtime_info.xfb_layout.Find(static_cast<IR::Attribute>(base_attr_index + element))};
         const u32 num_components{xfb_varying ? xfb_varying->components : remainder};
 
         const Id id{DefineOutput(ctx, ctx.F32[num_components], invocations)};
@@ -416,6 +424,130 @@ Id CasLoop(EmitContext& ctx, Operation operation, Id array_pointer, Id element_p
     return func;
 }
 
+Id AggregateAtomic(EmitContext& ctx, AggregateOperation operation, Id pointer, Id scope,
+                   Id semantics, Id value) {
+    switch (operation) {
+    case AggregateOperation::IAdd:
+        return ctx.OpAtomicIAdd(ctx.U32[1], pointer, scope, semantics, value);
+    case AggregateOperation::SMin:
+        return ctx.OpAtomicSMin(ctx.U32[1], pointer, scope, semantics, value);
+    case AggregateOperation::UMin:
+        return ctx.OpAtomicUMin(ctx.U32[1], pointer, scope, semantics, value);
+    case AggregateOperation::SMax:
+        return ctx.OpAtomicSMax(ctx.U32[1], pointer, scope, semantics, value);
+    case AggregateOperation::UMax:
+        return ctx.OpAtomicUMax(ctx.U32[1], pointer, scope, semantics, value);
+    case AggregateOperation::And:
+        return ctx.OpAtomicAnd(ctx.U32[1], pointer, scope, semantics, value);
+    case AggregateOperation::Or:
+        return ctx.OpAtomicOr(ctx.U32[1], pointer, scope, semantics, value);
+    case AggregateOperation::Xor:
+        return ctx.OpAtomicXor(ctx.U32[1], pointer, scope, semantics, value);
+    }
+    throw InvalidArgument("Invalid aggregate operation {}", static_cast<int>(operation));
+}
+
+Id AggregateGroup(EmitContext& ctx, AggregateOperation operation, Id scope,
+                  spv::GroupOperation group_operation, Id value) {
+    switch (operation) {
+    case AggregateOperation::IAdd:
+        return ctx.OpGroupNonUniformIAdd(ctx.U32[1], scope, group_operation, value);
+    case AggregateOperation::SMin:
+        return ctx.OpGroupNonUniformSMin(ctx.U32[1], scope, group_operation, value);
+    case AggregateOperation::UMin:
+        return ctx.OpGroupNonUniformUMin(ctx.U32[1], scope, group_operation, value);
+    case AggregateOperation::SMax:
+        return ctx.OpGroupNonUniformSMax(ctx.U32[1], scope, group_operation, value);
+    case AggregateOperation::UMax:
+        return ctx.OpGroupNonUniformUMax(ctx.U32[1], scope, group_operation, value);
+    case AggregateOperation::And:
+        return ctx.OpGroupNonUniformBitwiseAnd(ctx.U32[1], scope, group_operation, value);
+    case AggregateOperation::Or:
+        return ctx.OpGroupNonUniformBitwiseOr(ctx.U32[1], scope, group_operation, value);
+    case AggregateOperation::Xor:
+        return ctx.OpGroupNonUniformBitwiseXor(ctx.U32[1], scope, group_operation, value);
+    }
+    throw InvalidArgument("Invalid aggregate operation {}", static_cast<int>(operation));
+}
+
+Id AggregateCombine(EmitContext& ctx, AggregateOperation operation, Id lhs, Id rhs) {
+    switch (operation) {
+    case AggregateOperation::IAdd:
+        return ctx.OpIAdd(ctx.U32[1], lhs, rhs);
+    case AggregateOperation::SMin:
+        return ctx.OpSMin(ctx.U32[1], lhs, rhs);
+    case AggregateOperation::UMin:
+        return ctx.OpUMin(ctx.U32[1], lhs, rhs);
+    case AggregateOperation::SMax:
+        return ctx.OpSMax(ctx.U32[1], lhs, rhs);
+    case AggregateOperation::UMax:
+        return ctx.OpUMax(ctx.U32[1], lhs, rhs);
+    case AggregateOperation::And:
+        return ctx.OpBitwiseAnd(ctx.U32[1], lhs, rhs);
+    case AggregateOperation::Or:
+        return ctx.OpBitwiseOr(ctx.U32[1], lhs, rhs);
+    case AggregateOperation::Xor:
+        return ctx.OpBitwiseXor(ctx.U32[1], lhs, rhs);
+    }
+    throw InvalidArgument("Invalid aggregate operation {}", static_cast<int>(operation));
+}
+
+Id SharedAtomicAggregation(EmitContext& ctx, AggregateOperation operation) {
+    const Id zero{ctx.u32_zero_value};
+    const Id subgroup{ctx.Const(static_cast<u32>(spv::Scope::Subgroup))};
+    const Id scope{ctx.Const(static_cast<u32>(spv::Scope::Device))};
+
+    const Id uniform_label{ctx.OpLabel()};
+    const Id leader_label{ctx.OpLabel()};
+    const Id leader_merge_label{ctx.OpLabel()};
+    const Id divergent_label{ctx.OpLabel()};
+    const Id merge_label{ctx.OpLabel()};
+    const Id func_type{ctx.TypeFunction(ctx.U32[1], ctx.U32[1], ctx.U32[1])};
+
+    const Id func{ctx.OpFunction(ctx.U32[1], spv::FunctionControlMask::MaskNone, func_type)};
+    const Id offset{ctx.OpFunctionParameter(ctx.U32[1])};
+    const Id value{ctx.OpFunctionParameter(ctx.U32[1])};
+    ctx.AddLabel();
+    const Id index{ctx.OpShiftRightArithmetic(ctx.U32[1], offset, ctx.Const(2U))};
+    const Id pointer{ctx.profile.support_explicit_workgroup_layout
+                         ? ctx.OpAccessChain(ctx.shared_u32, ctx.shared_memory_u32, zero, index)
+                         : ctx.OpAccessChain(ctx.shared_u32, ctx.shared_memory_u32, index)};
+    const Id first_offset{ctx.OpGroupNonUniformBroadcastFirst(ctx.U32[1], subgroup, offset)};
+    const Id is_same_offset{ctx.OpIEqual(ctx.U1, offset, first_offset)};
+    const Id is_uniform{ctx.OpGroupNonUniformAll(ctx.U1, subgroup, is_same_offset)};
+    ctx.OpSelectionMerge(merge_label, spv::SelectionControlMask::MaskNone);
+    ctx.OpBranchConditional(is_uniform, uniform_label, divergent_label);
+
+    // Every active invocation accesses the same word, the lowest one issues the combined atomic
+    ctx.AddLabel(uniform_label);
+    const Id total{AggregateGroup(ctx, operation, subgroup, spv::GroupOperation::Reduce, value)};
+    const Id prefix{
+        AggregateGroup(ctx, operation, subgroup, spv::GroupOperation::ExclusiveScan, value)};
+    const Id is_leader{ctx.OpGroupNonUniformElect(ctx.U1, subgroup)};
+    ctx.OpSelectionMerge(leader_merge_label, spv::SelectionControlMask::MaskNone);
+    ctx.OpBranchConditional(is_leader, leader_label, leader_merge_label);
+
+    ctx.AddLabel(leader_label);
+    const Id leader_result{AggregateAtomic(ctx, operation, pointer, scope, zero, total)};
+    ctx.OpBranch(leader_merge_label);
+
+    ctx.AddLabel(leader_merge_label);
+    const Id leader_value{ctx.OpPhi(ctx.U32[1], leader_result, leader_label, zero, uniform_label)};
+    const Id previous{ctx.OpGroupNonUniformBroadcastFirst(ctx.U32[1], subgroup, leader_value)};
+    const Id uniform_result{AggregateCombine(ctx, operation, previous, prefix)};
+    ctx.OpBranch(merge_label);
+
+    ctx.AddLabel(divergent_label);
+    const Id divergent_result{AggregateAtomic(ctx, operation, pointer, scope, zero, value)};
+    ctx.OpBranch(merge_label);
+
+    ctx.AddLabel(merge_label);
+    ctx.OpReturnValue(ctx.OpPhi(ctx.U32[1], uniform_result, leader_merge_label, divergent_result,
+                                divergent_label));
+    ctx.OpFunctionEnd();
+    return func;
+}
+
 template <typename Desc>
 std::string NameOf(Stage stage, const Desc& desc, std::string_view prefix) {
     if (desc.count > 1) {
@@ -686,6 +818,30 @@ void EmitContext::DefineSharedMemoryFunctions(const IR::Program& program) {
         decrement_cas_shared = CasLoop(*this, Operation::Decrement, shared_memory_u32_type,
                                        shared_u32, U32[1], U32[1], spv::Scope::Workgroup);
     }
+    if (program.info.uses_shared_aggregated_iadd) {
+        aggregated_iadd_shared = SharedAtomicAggregation(*this, AggregateOperation::IAdd);
+    }
+    if (program.info.uses_shared_aggregated_smin) {
+        aggregated_smin_shared = SharedAtomicAggregation(*this, AggregateOperation::SMin);
+    }
+    if (program.info.uses_shared_aggregated_umin) {
+        aggregated_umin_shared = SharedAtomicAggregation(*this, AggregateOperation::UMin);
+    }
+    if (program.info.uses_shared_aggregated_smax) {
+        aggregated_smax_shared = SharedAtomicAggregation(*this, AggregateOperation::SMax);
+    }
+    if (program.info.uses_shared_aggregated_umax) {
+        aggregated_umax_shared = SharedAtomicAggregation(*this, AggregateOperation::UMax);
+    }
+    if (program.info.uses_shared_aggregated_and) {
+        aggregated_and_shared = SharedAtomicAggregation(*this, AggregateOperation::And);
+    }
+    if (program.info.uses_shared_aggregated_or) {
+        aggregated_or_shared = SharedAtomicAggregation(*this, AggregateOperation::Or);
+    }
+    if (program.info.uses_shared_aggregated_xor) {
+        aggregated_xor_shared = SharedAtomicAggregation(*this, AggregateOperation::Xor);
+    }
 }
 
 void EmitContext::DefineAttributeMemAccess(const Info& info) {
@@ -1101,17 +1257,26 @@ void EmitContext::DefineConstantBufferIndirectFunctions(const Info& info) {
         const Id merge_label{OpLabel()};
         const Id uniform_type{uniform_types.*member_ptr};
 
+        // Only the banks found to be reachable by the shader are switched over
         std::array<Id, Info::MAX_INDIRECT_CBUFS> buf_labels;
         std::array<Sirit::Literal, Info::MAX_INDIRECT_CBUFS> buf_literals;
+        std::array<u32, Info::MAX_INDIRECT_CBUFS> buf_indices;
+        size_t num_bufs{};
         for (u32 i = 0; i < Info::MAX_INDIRECT_CBUFS; i++) {
-            buf_labels[i] = OpLabel();
-            buf_literals[i] = Sirit::Literal{i};
+            if (((info.indirect_constant_buffer_mask >> i) & 1) == 0) {
+                continue;
+            }
+            buf_labels[num_bufs] = OpLabel();
+            buf_literals[num_bufs] = Sirit::Literal{i};
+            buf_indices[num_bufs] = i;
+            ++num_bufs;
         }
         OpSelectionMerge(merge_label, spv::SelectionControlMask::MaskNone);
-        OpSwitch(binding, buf_labels[0], buf_literals, buf_labels);
-        for (u32 i = 0; i < Info::MAX_INDIRECT_CBUFS; i++) {
+        OpSwitch(binding, buf_labels[0], std::span{buf_literals.data(), num_bufs},
+                 std::span{buf_labels.data(), num_bufs});
+        for (size_t i = 0; i < num_bufs; i++) {
             AddLabel(buf_labels[i]);
-            const Id cbuf{cbufs[i].*member_ptr};
+            const Id cbuf{cbufs[buf_indices[i]].*member_ptr};
             const Id access_chain{OpAccessChain(uniform_type, cbuf, u32_zero_value, offset)};
             const Id result{OpLoad(buffer_type, access_chain)};
             OpReturnValue(result);
@@ -279,6 +279,14 @@ public:
     Id increment_cas_ssbo{};
     Id decrement_cas_shared{};
     Id decrement_cas_ssbo{};
+    Id aggregated_iadd_shared{};
+    Id aggregated_smin_shared{};
+    Id aggregated_umin_shared{};
+    Id aggregated_smax_shared{};
+    Id aggregated_umax_shared{};
+    Id aggregated_and_shared{};
+    Id aggregated_or_shared{};
+    Id aggregated_xor_shared{};
     Id f32_add_cas{};
     Id f16x2_add_cas{};
     Id f16x2_min_cas{};
@@ -0,0 +1,548 @@
+// SPDX-License-Identifier: MPL-2.0
+// Copyright © 2026 Skyline Team and Contributors (https://github.com/skyline-emu/)
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <shader_compiler/backend/glasm/emit_glasm.h>
+#include <shader_compiler/backend/glsl/emit_glsl.h>
+#include <shader_compiler/backend/spirv/emit_spirv.h>
+#include <shader_compiler/common/log.h>
+#include <shader_compiler/environment.h>
+#include <shader_compiler/frontend/ir/post_order.h>
+#include <shader_compiler/frontend/maxwell/control_flow.h>
+#include <shader_compiler/frontend/maxwell/decode.h>
+#include <shader_compiler/frontend/maxwell/structured_control_flow.h>
+#include <shader_compiler/frontend/maxwell/translate_program.h>
+#include <shader_compiler/host_translate_info.h>
+#include <shader_compiler/ir_opt/passes.h>
+#include <shader_compiler/object_pool.h>
+#include <shader_compiler/profile.h>
+
+/**
+ * @brief Microbenchmarks for every stage of the shader recompiler
+ * @note Each benchmark runs over a fixed set of hand assembled Maxwell programs and reports the
+ *       time and the heap allocations per guest instruction as JSON on stdout
+ */
+
+namespace {
+// Allocation counters, only the benchmark binary replaces the global allocator
+size_t num_allocations{};
+size_t num_allocated_bytes{};
+
+// Keeps the decoded opcodes observable so the decode loop is not optimized away
+volatile u64 decode_sink{};
+} // Anonymous namespace
+
+void* operator new(size_t size) {
+    ++num_allocations;
+    num_allocated_bytes += size;
+    if (void* const pointer{std::malloc(size == 0 ? 1 : size)}) {
+        return pointer;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+namespace Shader::Log {
+void Debug(std::string_view) {}
+void Warn(std::string_view) {}
+void Error(std::string_view) {}
+} // namespace Shader::Log
+
+namespace Shader::Benchmark {
+namespace {
+constexpr u64 PT{7}; //!< Always true predicate
+
+/**
+ * @brief Tiny Maxwell assembler, inserts scheduling words every fourth slot
+ */
+class Assembler {
+public:
+    /**
+     * @return The address of the next emitted instruction
+     */
+    u32 Here() {
+        Align();
+        return static_cast<u32>(code.size() * sizeof(u64));
+    }
+
+    void Emit(u64 insn) {
+        Align();
+        code.push_back(insn);
+    }
+
+    void Emit(u64 insn, u64 pred) {
+        Emit((insn & ~(u64{0xf} << 16)) | (pred << 16));
+    }
+
+    static u64 Opcode(std::string_view pattern) {
+        u64 bits{};
+        u64 bit{63};
+        for (const char c : pattern) {
+            if (c == ' ') {
+                continue;
+            }
+            if (c == '1') {
+                bits |= u64{1} << bit;
+            }
+            --bit;
+        }
+        return bits | (PT << 16);
+    }
+
+    void MOV32I(u64 dest, u32 imm) {
+        Emit(Opcode("0000 0001 0000 ----") | dest | (u64{0xf} << 12) | (u64{imm} << 20));
+    }
+
+    void S2R(u64 dest, u64 special_reg) {
+        Emit(Opcode("1111 0000 1100 1---") | dest | (special_reg << 20));
+    }
+
+    void LDC(u64 dest, u64 index, u64 offset) {
+        // Size B32 with the default addressing mode through RZ
+        Emit(Opcode("1110 1111 1001 0---") | dest | (u64{0xff} << 8) | (offset << 20) |
+             (index << 36) | (u64{4} << 48));
+    }
+
+    void FADD(u64 dest, u64 a, u64 b, u64 pred = PT) {
+        Emit(Opcode("0101 1100 0101 1---") | dest | (a << 8) | (b << 20), pred);
+    }
+
+    void FMUL(u64 dest, u64 a, u64 b, u64 pred = PT) {
+        Emit(Opcode("0101 1100 0110 1---") | dest | (a << 8) | (b << 20), pred);
+    }
+
+    void FFMA(u64 dest, u64 a, u64 b, u64 c) {
+        Emit(Opcode("0101 1001 1--- ----") | dest | (a << 8) | (b << 20) | (c << 39));
+    }
+
+    void IADD(u64 dest, u64 a, u64 b) {
+        Emit(Opcode("0101 1100 0001 0---") | dest | (a << 8) | (b << 20));
+    }
+
+    /// ISETP.LT.AND dest_pred, PT, a, imm, PT
+    void ISETP_LT(u64 dest_pred, u64 a, u32 imm) {
+        Emit(Opcode("0011 011- 0110 ----") | PT | (dest_pred << 3) | (a << 8) |
+             (u64{imm} << 20) | (PT << 39) | (u64{1} << 49));
+    }
+
+    void BRA(u32 target, u64 pred = PT) {
+        const u32 pc{Here()};
+        const u64 offset{static_cast<u64>(static_cast<s64>(target) - pc - 8) & 0xff'ffff};
+        // Flow test T
+        Emit(Opcode("1110 0010 0100 ----") | 15 | (offset << 20), pred);
+    }
+
+    void STS(u64 src, u64 offset_reg) {
+        // Size B32
+        Emit(Opcode("1110 1111 0101 1---") | src | (offset_reg << 8) | (u64{4} << 48));
+    }
+
+    void EXIT() {
+        Emit(Opcode("1110 0011 0000 ----") | 15);
+    }
+
+    std::vector<u64> code;
+
+private:
+    void Align() {
+        if (code.size() % 4 == 0) {
+            code.push_back(0);
+        }
+    }
+};
+
+struct Input {
+    std::string_view name;
+    std::vector<u64> code;
+    u32 num_instructions;
+};
+
+/// Long straight-line block of arithmetic
+Input StraightLine() {
+    Assembler a;
+    a.S2R(0, 33); // SR_TID_X
+    a.LDC(1, 0, 0);
+    a.LDC(2, 0, 4);
+    for (u64 i = 0; i < 48; ++i) {
+        const u64 dest{3 + i % 8};
+        a.FFMA(dest, 1, 2, 3 + (i + 1) % 8);
+        a.FMUL(1, dest, 2);
+        a.FADD(2, 1, dest);
+    }
+    a.STS(2, 0);
+    a.EXIT();
+    return {"straight_line", std::move(a.code), 0};
+}
+
+/// Counted loop with a conditional back edge
+Input Loop() {
+    Assembler a;
+    a.S2R(0, 33); // SR_TID_X
+    a.MOV32I(1, 0);
+    a.MOV32I(2, 1);
+    a.LDC(3, 0, 0);
+    const u32 loop{a.Here()};
+    for (u64 i = 0; i < 8; ++i) {
+        a.FFMA(4, 3, 4, 3);
+    }
+    a.IADD(1, 1, 2);
+    a.ISETP_LT(0, 1, 16);
+    a.BRA(loop, 0);
+    a.STS(4, 0);
+    a.EXIT();
+    return {"loop", std::move(a.code), 0};
+}
+
+/// Many short predicated runs, each one splits the control flow graph
+Input Predicated() {
+    Assembler a;
+    a.S2R(0, 33); // SR_TID_X
+    a.LDC(1, 0, 0);
+    a.LDC(2, 0, 4);
+    for (u32 i = 0; i < 24; ++i) {
+        a.ISETP_LT(static_cast<u64>(i % 3), 0, i);
+        a.FADD(3, 1, 2, i % 3);
+        a.FMUL(1, 3, 2, (i % 3) | 8);
+    }
+    a.STS(1, 0);
+    a.EXIT();
+    return {"predicated", std::move(a.code), 0};
+}
+
+std::vector<Input> Inputs() {
+    std::vector<Input> inputs;
+    inputs.push_back(StraightLine());
+    inputs.push_back(Loop());
+    inputs.push_back(Predicated());
+    for (Input& input : inputs) {
+        for (size_t i = 0; i < input.code.size(); ++i) {
+            input.num_instructions += i % 4 != 0 ? 1 : 0;
+        }
+    }
+    return inputs;
+}
+
+class BenchmarkEnvironment final : public Environment {
+public:
+    explicit BenchmarkEnvironment(std::span<const u64> code_) : code{code_} {
+        stage = Stage::Compute;
+        start_address = 0;
+    }
+
+    u64 ReadInstruction(u32 address) override {
+        const size_t index{address / sizeof(u64)};
+        return index < code.size() ? code[index] : 0;
+    }
+
+    u32 ReadCbufValue(u32, u32) override {
+        return 0;
+    }
+
+    TextureType ReadTextureType(u32) override {
+        return TextureType::Color2D;
+    }
+
+    TexturePixelFormat ReadTexturePixelFormat(u32) override {
+        return TexturePixelFormat::OTHER;
+    }
+
+    u32 ReadViewportTransformState() override {
+        return 0;
+    }
+
+    u32 TextureBoundBuffer() const override {
+        return 0;
+    }
+
+    u32 LocalMemorySize() const override {
+        return 0;
+    }
+
+    u32 SharedMemorySize() const override {
+        return 0x1000;
+    }
+
+    std::array<u32, 3> WorkgroupSize() const override {
+        return {64, 1, 1};
+    }
+
+    bool HasHLEMacroState() const override {
+        return false;
+    }
+
+    std::optional<ReplaceConstant> GetReplaceConstBuffer(u32, u32) override {
+        return std::nullopt;
+    }
+
+    void Dump(u64) override {}
+
+private:
+    std::span<const u64> code;
+};
+
+struct Measurement {
+    u64 nanoseconds{};
+    size_t allocations{};
+    size_t bytes{};
+};
+
+/**
+ * @brief Accumulates the cost of the timed regions of a benchmark
+ */
+class Timer {
+public:
+    template <typename Func>
+    void Measure(Func&& func) {
+        const size_t allocations_begin{num_allocations};
+        const size_t bytes_begin{num_allocated_bytes};
+        const auto begin{std::chrono::steady_clock::now()};
+        func();
+        const auto end{std::chrono::steady_clock::now()};
+        result.nanoseconds += static_cast<u64>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+        result.allocations += num_allocations - allocations_begin;
+        result.bytes += num_allocated_bytes - bytes_begin;
+    }
+
+    Measurement result;
+};
+
+struct Report {
+    std::string stage;
+    std::string_view input;
+    u32 num_instructions;
+    u32 iterations;
+    Measurement measurement;
+};
+
+/**
+ * @brief Program state right before the first optimization pass, as seen by TranslateProgram
+ */
+struct Pipeline {
+    explicit Pipeline(BenchmarkEnvironment& env, const HostTranslateInfo& host_info)
+        : cfg{env, flow_block_pool, env.StartAddress()} {
+        program.syntax_list =
+            Maxwell::BuildASL(inst_pool, block_pool, env, cfg, host_info, program.diagnostics);
+        for (const IR::AbstractSyntaxNode& node : program.syntax_list) {
+            if (node.type == IR::AbstractSyntaxNode::Type::Block) {
+                program.blocks.push_back(node.data.block);
+            }
+        }
+        program.post_order_blocks = IR::PostOrder(program.syntax_list.front());
+        program.stage = env.ShaderStage();
+        program.workgroup_size = env.WorkgroupSize();
+        program.shared_memory_size = env.SharedMemorySize();
+    }
+
+    ObjectPool<Maxwell::Flow::Block> flow_block_pool;
+    ObjectPool<IR::Inst> inst_pool;
+    ObjectPool<IR::Block> block_pool;
+    Maxwell::Flow::CFG cfg;
+    IR::Program program;
+};
+
+class Runner {
+public:
+    explicit Runner(u32 iterations_) : iterations{iterations_} {}
+
+    void Run(const Input& input) {
+        BenchmarkEnvironment env{input.code};
+        BenchDecode(input, env);
+        BenchCFG(input, env);
+        BenchBuildASL(input, env);
+        BenchPasses(input, env);
+        BenchBackends(input, env);
+    }
+
+    std::string Json() const {
+        std::string json{"{\n  \"benchmarks\": [\n"};
+        for (size_t i = 0; i < reports.size(); ++i) {
+            const Report& report{reports[i]};
+            const double count{static_cast<double>(report.num_instructions) * report.iterations};
+            json += fmt::format(
+                "    {{\"stage\": \"{}\", \"input\": \"{}\", \"instructions\": {}, "
+                "\"iterations\": {}, \"ns_per_instruction\": {:.3f}, "
+                "\"allocations_per_instruction\": {:.3f}, \"bytes_per_instruction\": {:.3f}}}{}\n",
+                report.stage, report.input, report.num_instructions, report.iterations,
+                static_cast<double>(report.measurement.nanoseconds) / count,
+                static_cast<double>(report.measurement.allocations) / count,
+                static_cast<double>(report.measurement.bytes) / count,
+                i + 1 == reports.size() ? "" : ",");
+        }
+        json += "  ]\n}\n";
+        return json;
+    }
+
+private:
+    void BenchDecode(const Input& input, BenchmarkEnvironment& env) {
+        Timer timer;
+        u64 sink{};
+        for (u32 iteration = 0; iteration < iterations; ++iteration) {
+            timer.Measure([&] {
+                for (u32 address = 8; address < input.code.size() * 8; address += 8) {
+                    if (address % 32 != 0) {
+                        sink += static_cast<u64>(Maxwell::Decode(env.ReadInstruction(address)));
+                    }
+                }
+            });
+        }
+        decode_sink = sink;
+        Push("decode", input, timer);
+    }
+
+    void BenchCFG(const Input& input, BenchmarkEnvironment& env) {
+        Timer timer;
+        for (u32 iteration = 0; iteration < iterations; ++iteration) {
+            ObjectPool<Maxwell::Flow::Block> flow_block_pool;
+            std::optional<Maxwell::Flow::CFG> cfg;
+            timer.Measure([&] { cfg.emplace(env, flow_block_pool, env.StartAddress()); });
+        }
+        Push("cfg", input, timer);
+    }
+
+    void BenchBuildASL(const Input& input, BenchmarkEnvironment& env) {
+        Timer timer;
+        for (u32 iteration = 0; iteration < iterations; ++iteration) {
+            ObjectPool<Maxwell::Flow::Block> flow_block_pool;
+            ObjectPool<IR::Inst> inst_pool;
+            ObjectPool<IR::Block> block_pool;
+            Maxwell::Flow::CFG cfg{env, flow_block_pool, env.StartAddress()};
+            IR::AbstractSyntaxList syntax_list;
+            IR::Diagnostics diagnostics;
+            timer.Measure([&] {
+                syntax_list =
+                    Maxwell::BuildASL(inst_pool, block_pool, env, cfg, host_info, diagnostics);
+            });
+        }
+        Push("build_asl", input, timer);
+    }
+
+    void BenchPasses(const Input& input, BenchmarkEnvironment& env) {
+        using PassFunc = std::function<void(IR::Program&)>;
+        struct Pass {
+            std::string_view name;
+            PassFunc func;
+            Timer timer;
+        };
+        // Same order as TranslateProgram, each pass is timed on the output of the previous one
+        std::array passes{
+            Pass{"lower_fp16_to_fp32", Optimization::LowerFp16ToFp32, {}},
+            Pass{"lower_int64_to_int32", Optimization::LowerInt64ToInt32, {}},
+            Pass{"ssa_rewrite", Optimization::SsaRewritePass, {}},
+            Pass{"constant_propagation",
+                 [&](IR::Program& program) { Optimization::ConstantPropagationPass(env, program); },
+                 {}},
+            Pass{"lower_fp64_to_fp32_pair", Optimization::LowerFp64ToFp32Pair, {}},
+            Pass{"position",
+                 [&](IR::Program& program) { Optimization::PositionPass(env, program); }, {}},
+            Pass{"global_memory_to_storage_buffer",
+                 [&](IR::Program& program) {
+                     Optimization::GlobalMemoryToStorageBufferPass(program, host_info);
+                 },
+                 {}},
+            Pass{"texture",
+                 [&](IR::Program& program) {
+                     Optimization::TexturePass(env, program, host_info);
+                 },
+                 {}},
+            Pass{"rescaling", Optimization::RescalingPass, {}},
+            Pass{"shared_atomic_aggregation", Optimization::SharedAtomicAggregationPass, {}},
+            Pass{"dead_code_elimination", Optimization::DeadCodeEliminationPass, {}},
+            Pass{"identity_removal", Optimization::IdentityRemovalPass, {}},
+            Pass{"verification", Optimization::VerificationPass, {}},
+            Pass{"collect_shader_info",
+                 [&](IR::Program& program) { Optimization::CollectShaderInfoPass(env, program); },
+                 {}},
+            Pass{"layer",
+                 [&](IR::Program& program) { Optimization::LayerPass(program, host_info); }, {}},
+        };
+        for (u32 iteration = 0; iteration < iterations; ++iteration) {
+            Pipeline pipeline{env, host_info};
+            for (Pass& pass : passes) {
+                pass.timer.Measure([&] { pass.func(pipeline.program); });
+            }
+        }
+        for (const Pass& pass : passes) {
+            Push(fmt::format("pass.{}", pass.name), input, pass.timer);
+        }
+    }
+
+    void BenchBackends(const Input& input, BenchmarkEnvironment& env) {
+        const auto bench{[&](std::string_view name, auto&& emit) {
+            Timer timer;
+            for (u32 iteration = 0; iteration < iterations; ++iteration) {
+                ObjectPool<Maxwell::Flow::Block> flow_block_pool;
+                ObjectPool<IR::Inst> inst_pool;
+                ObjectPool<IR::Block> block_pool;
+                Maxwell::Flow::CFG cfg{env, flow_block_pool, env.StartAddress()};
+                IR::Program program{
+                    Maxwell::TranslateProgram(inst_pool, block_pool, env, cfg, host_info)};
+                timer.Measure([&] { emit(program); });
+            }
+            Push(fmt::format("backend.{}", name), input, timer);
+        }};
+        bench("spirv", [&](IR::Program& program) {
+            Backend::Bindings bindings;
+            static_cast<void>(Backend::SPIRV::EmitSPIRV(profile, {}, program, bindings));
+        });
+        bench("glsl", [&](IR::Program& program) {
+            Backend::Bindings bindings;
+            static_cast<void>(Backend::GLSL::EmitGLSL(profile, {}, program, bindings));
+        });
+        bench("glasm", [&](IR::Program& program) {
+            Backend::Bindings bindings;
+            static_cast<void>(Backend::GLASM::EmitGLASM(profile, {}, program, bindings));
+        });
+    }
+
+    void Push(std::string stage, const Input& input, const Timer& timer) {
+        reports.push_back({
+            .stage = std::move(stage),
+            .input = input.name,
+            .num_instructions = input.num_instructions,
+            .iterations = iterations,
+            .measurement = timer.result,
+        });
+    }
+
+    u32 iterations;
+    Profile profile{};
+    HostTranslateInfo host_info{
+        .support_float16 = true,
+        .support_int64 = true,
+    };
+    std::vector<Report> reports;
+};
+} // Anonymous namespace
+} // namespace Shader::Benchmark
+
+int main(int argc, char** argv) {
+    const u32 iterations{argc > 1 ? static_cast<u32>(std::strtoul(argv[1], nullptr, 10)) : 100};
+    Shader::Benchmark::Runner runner{iterations == 0 ? 1 : iterations};
+    for (const auto& input : Shader::Benchmark::Inputs()) {
+        runner.Run(input);
+    }
+    const std::string json{runner.Json()};
+    std::fwrite(json.data(), 1, json.size(), stdout);
+    return 0;
+}
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MPL-2.0
+// Copyright © 2026 Skyline Team and Contributors (https://github.com/skyline-emu/)
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+#include "common_types.h"
+
+namespace Shader {
+    /**
+     * @brief The stages of a compile that heap allocations are attributed to
+     */
+    enum class CompilePhase : u32 {
+        ControlFlow, //!< Flow::CFG construction
+        Translation, //!< Structurization and translation of Maxwell instructions into IR
+        Optimization, //!< IR passes, including the collection of shader info
+        Backend, //!< SPIR-V, GLSL or GLASM emission
+    };
+    constexpr size_t NUM_COMPILE_PHASES{4};
+
+    struct AllocationCounters {
+        u64 count{}; //!< The amount of heap allocations
+        u64 bytes{}; //!< The total amount of bytes requested from the heap
+
+        AllocationCounters &operator+=(const AllocationCounters &rhs) {
+            count += rhs.count;
+            bytes += rhs.bytes;
+            return *this;
+        }
+    };
+
+    /**
+     * @brief Per-phase heap allocation counters of a single compile
+     * @note Only allocations made by the shader compiler's own containers are accounted, there is no global allocator hook
+     */
+    struct AllocationStats {
+        std::array<AllocationCounters, NUM_COMPILE_PHASES> phases{};
+
+        AllocationCounters &operator[](CompilePhase phase) {
+            return phases[static_cast<size_t>(phase)];
+        }
+
+        const AllocationCounters &operator[](CompilePhase phase) const {
+            return phases[static_cast<size_t>(phase)];
+        }
+
+        AllocationStats &operator+=(const AllocationStats &rhs) {
+            for (size_t phase{}; phase < NUM_COMPILE_PHASES; ++phase)
+                phases[phase] += rhs.phases[phase];
+            return *this;
+        }
+
+        AllocationCounters Total() const {
+            AllocationCounters total{};
+            for (const AllocationCounters &counters : phases)
+                total += counters;
+            return total;
+        }
+    };
+
+    namespace Allocation {
+        namespace detail {
+            inline thread_local AllocationStats *stats{}; //!< The stats of the compile running on this thread, if any
+            inline thread_local CompilePhase phase{};
+        }
+
+        /**
+         * @brief Accounts an allocation of the specified size to the active phase of the compile on this thread
+         */
+        inline void Record(size_t bytes) noexcept {
+            if (detail::stats) [[likely]] {
+                AllocationCounters &counters{(*detail::stats)[detail::phase]};
+                ++counters.count;
+                counters.bytes += bytes;
+            }
+        }
+
+        /**
+         * @brief RAII scope which attributes all recorded allocations on this thread to a phase of the supplied stats
+         * @note Scopes can be nested, the previous scope is restored on destruction
+         */
+        class Scope {
+          public:
+            Scope(AllocationStats &stats, CompilePhase phase) : previous_stats{detail::stats}, previous_phase{detail::phase} {
+                detail::stats = &stats;
+                detail::phase = phase;
+            }
+
+            ~Scope() {
+                detail::stats = previous_stats;
+                detail::phase = previous_phase;
+            }
+
+            /**
+             * @brief Attributes subsequent allocations to a different phase of the same stats
+             */
+            void SetPhase(CompilePhase phase) {
+                detail::phase = phase;
+            }
+
+            Scope(const Scope &) = delete;
+            Scope &operator=(const Scope &) = delete;
+
+          private:
+            AllocationStats *previous_stats;
+            CompilePhase previous_phase;
+        };
+
+        /**
+         * @brief A std::allocator wrapper which records every allocation it makes
+         */
+        template<typename T>
+        struct CountingAllocator : std::allocator<T> {
+            using value_type = T;
+
+            template<typename U>
+            struct rebind {
+                using other = CountingAllocator<U>;
+            };
+
+            CountingAllocator() noexcept = default;
+
+            template<typename U>
+            CountingAllocator(const CountingAllocator<U> &) noexcept {}
+
+            T *allocate(size_t n) {
+                Record(n * sizeof(T));
+                return std::allocator<T>::allocate(n);
+            }
+
+            template<typename U>
+            bool operator==(const CountingAllocator<U> &) const noexcept {
+                return true;
+            }
+        };
+    }
+}
@@ -0,0 +1,234 @@
+// SPDX-License-Identifier: MPL-2.0
+// Copyright © 2026 Skyline Team and Contributors (https://github.com/skyline-emu/)
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define SHADER_HASH_AVX2
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SHADER_HASH_NEON
+#endif
+
+#include "hash.h"
+
+namespace Shader {
+    namespace {
+        constexpr u64 PRIME_1{0x9E3779B185EBCA87};
+        constexpr u64 PRIME_2{0xC2B2AE3D27D4EB4F};
+        constexpr u64 PRIME_3{0x165667B19E3779F9};
+        constexpr u32 PRIME32_1{0x9E3779B1};
+
+        /**
+         * @brief Loads a little-endian 64-bit word regardless of the host byte order, this is folded into a single load on little-endian hosts
+         */
+        u64 Load64(const u8 *data) {
+            u64 value{};
+            for (size_t index{}; index < sizeof(u64); index++)
+                value |= static_cast<u64>(data[index]) << (index * 8);
+            return value;
+        }
+
+        /**
+         * @brief The 64-bit finalizer of MurmurHash3, every input bit affects every output bit
+         */
+        u64 Avalanche(u64 value) {
+            value ^= value >> 33;
+            value *= 0xFF51AFD7ED558CCD;
+            value ^= value >> 33;
+            value *= 0xC4CEB9FE1A85EC53;
+            value ^= value >> 33;
+            return value;
+        }
+
+        constexpr size_t STRIPE_WORDS{8}; //!< The amount of words consumed by a single accumulation, every word has its own accumulator lane
+        constexpr size_t BLOCK_STRIPES{16}; //!< The amount of stripes between scrambles of the accumulators
+        constexpr size_t SCRAMBLE_OFFSET{BLOCK_STRIPES}; //!< The offset of the scramble key in the secret
+        constexpr size_t MERGE_OFFSET{SCRAMBLE_OFFSET + STRIPE_WORDS}; //!< The offset of the merge key in the secret
+
+        /**
+         * @brief The key material, stripes use a sliding window of it so that reordering stripes within a block changes the hash
+         */
+        constexpr std::array<u64, MERGE_OFFSET + STRIPE_WORDS> SECRET{[] {
+            std::array<u64, MERGE_OFFSET + STRIPE_WORDS> secret{};
+            u64 state{PRIME_3};
+            for (u64 &word : secret) {
+                // SplitMix64
+                state += 0x9E3779B97F4A7C15;
+                u64 value{state};
+                value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+                value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+                word = value ^ (value >> 31);
+            }
+            return secret;
+        }()};
+
+        void AccumulateScalar(u64 *acc, const u64 *words, const u64 *key) {
+            for (size_t lane{}; lane < STRIPE_WORDS; lane++) {
+                const u64 data_key{words[lane] ^ key[lane]};
+                acc[lane ^ 1] += words[lane];
+                acc[lane] += (data_key & 0xFFFFFFFF) * (data_key >> 32);
+            }
+        }
+
+        void ScrambleScalar(u64 *acc, const u64 *key) {
+            for (size_t lane{}; lane < STRIPE_WORDS; lane++) {
+                u64 value{acc[lane]};
+                value ^= value >> 47;
+                value ^= key[lane];
+                acc[lane] = value * PRIME32_1;
+            }
+        }
+
+        void ProcessStripesScalar(u64 *acc, const u64 *words, size_t stripes) {
+            for (size_t stripe{}; stripe < stripes; stripe++) {
+                AccumulateScalar(acc, words + stripe * STRIPE_WORDS, SECRET.data() + stripe % BLOCK_STRIPES);
+                if (stripe % BLOCK_STRIPES == BLOCK_STRIPES - 1)
+                    ScrambleScalar(acc, SECRET.data() + SCRAMBLE_OFFSET);
+            }
+        }
+
+        #ifdef SHADER_HASH_AVX2
+        [[gnu::target("avx2")]] void ProcessStripesAvx2(u64 *acc, const u64 *words, size_t stripes) {
+            __m256i acc_vec[2]{
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc)),
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc + 4)),
+            };
+            const __m256i prime{_mm256_set1_epi32(static_cast<int>(PRIME32_1))};
+            for (size_t stripe{}; stripe < stripes; stripe++) {
+                const u64 *key{SECRET.data() + stripe % BLOCK_STRIPES};
+                for (size_t half{}; half < std::size(acc_vec); half++) {
+                    const __m256i data{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(words + stripe * STRIPE_WORDS + half * 4))};
+                    const __m256i data_key{_mm256_xor_si256(data, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(key + half * 4)))};
+                    const __m256i product{_mm256_mul_epu32(data_key, _mm256_srli_epi64(data_key, 32))};
+                    // Swapping the 64-bit halves of each 128-bit lane adds every word into the accumulator of its neighbour
+                    const __m256i swapped{_mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2))};
+                    acc_vec[half] = _mm256_add_epi64(acc_vec[half], _mm256_add_epi64(product, swapped));
+                }
+                if (stripe % BLOCK_STRIPES == BLOCK_STRIPES - 1) {
+                    for (size_t half{}; half < std::size(acc_vec); half++) {
+                        __m256i value{acc_vec[half]};
+                        value = _mm256_xor_si256(value, _mm256_srli_epi64(value, 47));
+                        value = _mm256_xor_si256(value, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(SECRET.data() + SCRAMBLE_OFFSET + half * 4)));
+                        // A 64x32-bit multiplication out of two 32x32-bit ones
+                        const __m256i low{_mm256_mul_epu32(value, prime)};
+                        const __m256i high{_mm256_mul_epu32(_mm256_srli_epi64(value, 32), prime)};
+                        acc_vec[half] = _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+                    }
+                }
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc), acc_vec[0]);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + 4), acc_vec[1]);
+        }
+        #endif
+
+        #ifdef SHADER_HASH_NEON
+        void ProcessStripesNeon(u64 *acc, const u64 *words, size_t stripes) {
+            uint64x2_t acc_vec[4]{vld1q_u64(acc), vld1q_u64(acc + 2), vld1q_u64(acc + 4), vld1q_u64(acc + 6)};
+            for (size_t stripe{}; stripe < stripes; stripe++) {
+                const u64 *key{SECRET.data() + stripe % BLOCK_STRIPES};
+                for (size_t quarter{}; quarter < std::size(acc_vec); quarter++) {
+                    const uint64x2_t data{vld1q_u64(words + stripe * STRIPE_WORDS + quarter * 2)};
+                    const uint64x2_t data_key{veorq_u64(data, vld1q_u64(key + quarter * 2))};
+                    const uint64x2_t product{vmull_u32(vmovn_u64(data_key), vshrn_n_u64(data_key, 32))};
+                    const uint64x2_t swapped{vextq_u64(data, data, 1)};
+                    acc_vec[quarter] = vaddq_u64(acc_vec[quarter], vaddq_u64(product, swapped));
+                }
+                if (stripe % BLOCK_STRIPES == BLOCK_STRIPES - 1) {
+                    for (size_t quarter{}; quarter < std::size(acc_vec); quarter++) {
+                        uint64x2_t value{acc_vec[quarter]};
+                        value = veorq_u64(value, vshrq_n_u64(value, 47));
+                        value = veorq_u64(value, vld1q_u64(SECRET.data() + SCRAMBLE_OFFSET + quarter * 2));
+                        const uint64x2_t low{vmull_n_u32(vmovn_u64(value), PRIME32_1)};
+                        const uint64x2_t high{vmull_n_u32(vshrn_n_u64(value, 32), PRIME32_1)};
+                        acc_vec[quarter] = vaddq_u64(low, vshlq_n_u64(high, 32));
+                    }
+                }
+            }
+            for (size_t quarter{}; quarter < std::size(acc_vec); quarter++)
+                vst1q_u64(acc + quarter * 2, acc_vec[quarter]);
+        }
+        #endif
+
+        void ProcessStripes(u64 *acc, const u64 *words, size_t stripes) {
+            #if defined(SHADER_HASH_AVX2)
+            static const bool has_avx2{__builtin_cpu_supports("avx2") != 0};
+            if (has_avx2)
+                ProcessStripesAvx2(acc, words, stripes);
+            else
+                ProcessStripesScalar(acc, words, stripes);
+            #elif defined(SHADER_HASH_NEON)
+            ProcessStripesNeon(acc, words, stripes);
+            #else
+            ProcessStripesScalar(acc, words, stripes);
+            #endif
+        }
+
+        /**
+         * @return The full 128-bit product of the arguments folded into 64 bits
+         */
+        u64 Multiply128Fold64(u64 lhs, u64 rhs) {
+            constexpr u64 LOW_MASK{0xFFFFFFFF};
+            const u64 low_low{(lhs & LOW_MASK) * (rhs & LOW_MASK)};
+            const u64 high_low{(lhs >> 32) * (rhs & LOW_MASK)};
+            const u64 low_high{(lhs & LOW_MASK) * (rhs >> 32)};
+            const u64 high_high{(lhs >> 32) * (rhs >> 32)};
+            const u64 cross{(low_low >> 32) + (high_low & LOW_MASK) + low_high};
+            const u64 upper{(high_low >> 32) + (cross >> 32) + high_high};
+            const u64 lower{(cross << 32) | (low_low & LOW_MASK)};
+            return lower ^ upper;
+        }
+    }
+
+    Hash128 HashBytes(std::span<const u8> data, u64 seed) {
+        u64 low{seed ^ PRIME_1}, high{seed ^ PRIME_2};
+        const auto round{[&](u64 a, u64 b) {
+            low = std::rotl(low ^ (a * PRIME_2), 31) * PRIME_1;
+            high = std::rotl(high ^ (b * PRIME_1), 27) * PRIME_2;
+            low += high;
+            high += low;
+        }};
+
+        size_t offset{};
+        for (; offset + 16 <= data.size(); offset += 16)
+            round(Load64(data.data() + offset), Load64(data.data() + offset + 8));
+
+        // The tail is zero padded, the length is mixed in below to tell apart inputs which only differ by trailing zeroes
+        if (offset != data.size()) {
+            u8 tail[16]{};
+            std::memcpy(tail, data.data() + offset, data.size() - offset);
+            round(Load64(tail), Load64(tail + 8));
+        }
+
+        low ^= static_cast<u64>(data.size());
+        high ^= static_cast<u64>(data.size()) * PRIME_3;
+        low = Avalanche(low + high);
+        high = Avalanche(high + low);
+        return {low, high};
+    }
+
+    u64 HashWords(std::span<const u64> words, u64 seed) {
+        std::array<u64, STRIPE_WORDS> acc{PRIME32_1, PRIME_1, PRIME_2, PRIME_3, 0x85EBCA77C2B2AE63, 0x85EBCA77, 0x27D4EB2F165667C5, 0xC2B2AE3D};
+        for (size_t lane{}; lane < acc.size(); lane++)
+            acc[lane] += lane % 2 == 0 ? seed : 0 - seed;
+
+        const size_t stripes{words.size() / STRIPE_WORDS};
+        ProcessStripes(acc.data(), words.data(), stripes);
+
+        // The last partial stripe is zero padded, the length is mixed in below to tell apart inputs which only differ by trailing zeroes
+        if (size_t remaining{words.size() % STRIPE_WORDS}) {
+            std::array<u64, STRIPE_WORDS> tail{};
+            std::copy_n(words.data() + stripes * STRIPE_WORDS, remaining, tail.begin());
+            AccumulateScalar(acc.data(), tail.data(), SECRET.data() + stripes % BLOCK_STRIPES);
+        }
+
+        u64 result{static_cast<u64>(words.size()) * PRIME_1};
+        for (size_t lane{}; lane < STRIPE_WORDS; lane += 2)
+            result += Multiply128Fold64(acc[lane] ^ SECRET[MERGE_OFFSET + lane], acc[lane + 1] ^ SECRET[MERGE_OFFSET + lane + 1]);
+        return Avalanche(result);
+    }
+}
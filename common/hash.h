@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: MPL-2.0
+// Copyright © 2026 Skyline Team and Contributors (https://github.com/skyline-emu/)
+
+#pragma once
+
+#include <span>
+
+#include "common_types.h"
+
+namespace Shader {
+    /**
+     * @brief A 128-bit hash value, the low half can be used by itself as a 64-bit hash
+     */
+    struct Hash128 {
+        u64 low;
+        u64 high;
+
+        constexpr bool operator==(const Hash128 &) const = default;
+    };
+
+    /**
+     * @brief Hashes a byte stream, the result only depends on the bytes and the seed so it's stable across hosts and runs
+     */
+    Hash128 HashBytes(std::span<const u8> data, u64 seed = 0);
+
+    /**
+     * @brief Hashes a stream of 64-bit words with an XXH3-style stripe accumulator, this is vectorized with AVX2 or NEON when available
+     * @note All code paths produce identical results, the hash is stable across hosts and runs
+     */
+    u64 HashWords(std::span<const u64> words, u64 seed = 0);
+}
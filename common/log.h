@@ -3,15 +3,87 @@
 
 #pragma once
 
+#include <atomic>
+#include <iterator>
+#include <string_view>
+
 #include <fmt/format.h>
 
+/**
+ * @brief The minimum level that log statements are compiled in for, statements below it are discarded entirely
+ * @note This corresponds to the values of Shader::Log::Level and can be overridden by the build
+ */
+#ifndef SHADER_COMPILER_MIN_LOG_LEVEL
+#define SHADER_COMPILER_MIN_LOG_LEVEL 0
+#endif
+
+/**
+ * @brief Marks a function as cold and never inlined, MSVC has no cold attribute and warns about unknown GNU ones
+ */
+#if defined(_MSC_VER) && !defined(__clang__)
+#define SHADER_LOG_COLD __declspec(noinline)
+#else
+#define SHADER_LOG_COLD [[gnu::cold, gnu::noinline]]
+#endif
+
 namespace Shader::Log {
+    enum class Level : int {
+        Debug = 0,
+        Warn = 1,
+        Error = 2,
+        None = 3, //!< Disables all logging
+    };
+
     // Proxy logging framework, these functions are implemented by Skyline
-    void Debug(const std::string& message);
-    void Warn(const std::string& message);
-    void Error(const std::string& message);
+    void Debug(std::string_view message);
+    void Warn(std::string_view message);
+    void Error(std::string_view message);
+
+    namespace detail {
+        inline std::atomic<Level> level{Level::Debug};
+
+        /**
+         * @brief Formats a message into a stack buffer and passes it to the supplied proxy function
+         * @note This is out of the fast path on purpose so the level check at the call site remains cheap
+         */
+        template<typename... Args>
+        SHADER_LOG_COLD void Write(void (*sink)(std::string_view), fmt::format_string<Args...> format, Args &&... args) {
+            fmt::memory_buffer buffer;
+            fmt::format_to(std::back_inserter(buffer), format, std::forward<Args>(args)...);
+            sink(std::string_view{buffer.data(), buffer.size()});
+        }
+    }
+
+    /**
+     * @brief Sets the minimum level of messages which are formatted and passed to the proxy functions at runtime
+     */
+    inline void SetLevel(Level level) noexcept {
+        detail::level.store(level, std::memory_order_relaxed);
+    }
+
+    inline Level GetLevel() noexcept {
+        return detail::level.load(std::memory_order_relaxed);
+    }
+
+    constexpr bool IsCompiledIn(Level level) {
+        return static_cast<int>(level) >= SHADER_COMPILER_MIN_LOG_LEVEL;
+    }
+
+    /**
+     * @return If a message of the supplied level would be consumed, this can be used to guard computing expensive log arguments
+     */
+    inline bool IsEnabled(Level level) noexcept {
+        return IsCompiledIn(level) && level >= GetLevel();
+    }
 }
 
-#define LOG_DEBUG(tag, message, ...) Shader::Log::Debug(fmt::format("Shader Compiler (" #tag "): " message __VA_OPT__(,) __VA_ARGS__))
-#define LOG_WARNING(tag, message, ...) Shader::Log::Warn(fmt::format("Shader Compiler (" #tag "): " message __VA_OPT__(,) __VA_ARGS__))
-#define LOG_ERROR(tag, message, ...) Shader::Log::Error(fmt::format("Shader Compiler (" #tag "): " message __VA_OPT__(,) __VA_ARGS__))
+#define SHADER_LOG(level, sink, tag, message, ...)                                                                          \
+    do {                                                                                                                    \
+        if constexpr (::Shader::Log::IsCompiledIn(level))                                                                   \
+            if (::Shader::Log::GetLevel() <= level) [[unlikely]]                                                            \
+                ::Shader::Log::detail::Write(&sink, "Shader Compiler (" #tag "): " message __VA_OPT__(,) __VA_ARGS__);    \
+    } while (false)
+
+#define LOG_DEBUG(tag, message, ...) SHADER_LOG(::Shader::Log::Level::Debug, ::Shader::Log::Debug, tag, message __VA_OPT__(,) __VA_ARGS__)
+#define LOG_WARNING(tag, message, ...) SHADER_LOG(::Shader::Log::Level::Warn, ::Shader::Log::Warn, tag, message __VA_OPT__(,) __VA_ARGS__)
+#define LOG_ERROR(tag, message, ...) SHADER_LOG(::Shader::Log::Level::Error, ::Shader::Log::Error, tag, message __VA_OPT__(,) __VA_ARGS__)
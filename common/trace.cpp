@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MPL-2.0
+// Copyright © 2026 Skyline Team and Contributors (https://github.com/skyline-emu/)
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "trace.h"
+
+namespace Shader::Trace {
+    namespace {
+        /**
+         * @brief A ring buffer of the most recent events recorded by a single thread
+         * @note The mutex is only ever contended while a flush is in progress
+         */
+        struct ThreadBuffer {
+            std::mutex mutex;
+            std::array<Event, RING_BUFFER_EVENTS> events;
+            u64 head{}; //!< The total amount of events written, the ring index is head % RING_BUFFER_EVENTS
+            u64 tail{}; //!< The value of head at the last flush
+            u32 thread_id;
+
+            explicit ThreadBuffer(u32 thread_id) : thread_id{thread_id} {}
+        };
+
+        struct Registry {
+            std::mutex mutex;
+            std::vector<std::shared_ptr<ThreadBuffer>> buffers; //!< Buffers outlive their threads until the next flush
+            u32 next_thread_id{1};
+        };
+
+        Registry &GetRegistry() {
+            static Registry registry;
+            return registry;
+        }
+
+        ThreadBuffer &GetThreadBuffer() {
+            thread_local std::shared_ptr<ThreadBuffer> buffer{[] {
+                Registry &registry{GetRegistry()};
+                std::scoped_lock lock{registry.mutex};
+                auto new_buffer{std::make_shared<ThreadBuffer>(registry.next_thread_id++)};
+                registry.buffers.push_back(new_buffer);
+                return new_buffer;
+            }()};
+            return *buffer;
+        }
+    }
+
+    namespace detail {
+        u64 Now() noexcept {
+            return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        void Record(const char *name, u64 begin, u32 arg) noexcept {
+            const u64 duration{std::min<u64>(Now() - begin, std::numeric_limits<u32>::max())};
+            ThreadBuffer &buffer{GetThreadBuffer()};
+            std::scoped_lock lock{buffer.mutex};
+            buffer.events[buffer.head % RING_BUFFER_EVENTS] = Event{
+                .name = name,
+                .begin = begin,
+                .duration = static_cast<u32>(duration),
+                .arg = arg,
+            };
+            ++buffer.head;
+        }
+    }
+
+    std::string FlushJson() {
+        std::string json{"{\"traceEvents\":["};
+        bool first{true};
+        Registry &registry{GetRegistry()};
+        std::scoped_lock registry_lock{registry.mutex};
+        for (const std::shared_ptr<ThreadBuffer> &buffer : registry.buffers) {
+            std::scoped_lock lock{buffer->mutex};
+            const u64 begin{std::max(buffer->tail, buffer->head > RING_BUFFER_EVENTS ? buffer->head - RING_BUFFER_EVENTS : 0)};
+            for (u64 index{begin}; index < buffer->head; ++index) {
+                const Event &event{buffer->events[index % RING_BUFFER_EVENTS]};
+                // Chrome trace timestamps and durations are in microseconds
+                fmt::format_to(std::back_inserter(json), "{}{{\"name\":\"{}\",\"cat\":\"shader\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":0,\"tid\":{},\"args\":{{\"arg\":{}}}}}",
+                               first ? "" : ",", event.name, static_cast<double>(event.begin) / 1000.0, static_cast<double>(event.duration) / 1000.0, buffer->thread_id, event.arg);
+                first = false;
+            }
+            buffer->tail = buffer->head;
+        }
+        // Drop the buffers of threads which have exited, their events have been flushed
+        std::erase_if(registry.buffers, [](const std::shared_ptr<ThreadBuffer> &buffer) { return buffer.use_count() == 1; });
+        json += "],\"displayTimeUnit\":\"ns\"}";
+        return json;
+    }
+}
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: MPL-2.0
+// Copyright © 2026 Skyline Team and Contributors (https://github.com/skyline-emu/)
+
+#pragma once
+
+#include <atomic>
+#include <string>
+
+#include "common_funcs.h"
+#include "common_types.h"
+
+namespace Shader::Trace {
+    /**
+     * @brief A compact fixed-size record of a completed scope
+     */
+    struct Event {
+        const char *name; //!< A string with static storage duration
+        u64 begin; //!< Timestamp in nanoseconds of std::chrono::steady_clock
+        u32 duration; //!< Duration in nanoseconds, saturated at ~4.29 seconds
+        u32 arg; //!< An event specific argument, such as a function index
+    };
+    static_assert(sizeof(Event) == 24);
+
+    constexpr size_t RING_BUFFER_EVENTS{4096}; //!< The amount of events retained per thread, older events are overwritten
+
+    namespace detail {
+        inline std::atomic<bool> enabled{};
+
+        u64 Now() noexcept;
+
+        void Record(const char *name, u64 begin, u32 arg) noexcept;
+    }
+
+    /**
+     * @brief Enables or disables recording of trace events, this is disabled by default
+     */
+    inline void SetEnabled(bool enabled) noexcept {
+        detail::enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    inline bool IsEnabled() noexcept {
+        return detail::enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Drains the ring buffers of all threads into Chrome trace event JSON
+     * @note The output can be loaded directly by chrome://tracing and Perfetto, timestamps are in the steady_clock domain
+     */
+    std::string FlushJson();
+
+    /**
+     * @brief RAII scope which records a complete event into this thread's ring buffer when tracing is enabled
+     */
+    class Scope {
+      public:
+        explicit Scope(const char *name, u32 arg = 0) noexcept : name{IsEnabled() ? name : nullptr}, arg{arg} {
+            if (this->name)
+                begin = detail::Now();
+        }
+
+        ~Scope() {
+            if (name)
+                detail::Record(name, begin, arg);
+        }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+      private:
+        const char *name;
+        u64 begin{};
+        u32 arg;
+    };
+}
+
+/**
+ * @brief Traces the enclosing scope under the supplied static name and an optional argument
+ */
+#define SHADER_TRACE_SCOPE(name, ...) const ::Shader::Trace::Scope CONCAT(shader_trace_scope_, __LINE__){name __VA_OPT__(,) __VA_ARGS__}
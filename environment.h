@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <optional>
 
 #include <shader_compiler/common/common_types.h>
 #include <shader_compiler/program_header.h>
@@ -24,6 +25,13 @@ public:
 
     [[nodiscard]] virtual TexturePixelFormat ReadTexturePixelFormat(u32 raw_handle) = 0;
 
+    /// Format the storage image of the given handle can be declared with, typeless surface accesses
+    /// on it are then emitted as formatted accesses. Implementations have to key their
+    /// caches on the returned value, by default it's unknown and accesses stay typeless.
+    [[nodiscard]] virtual ImageFormat ReadImageFormat([[maybe_unused]] u32 raw_handle) {
+        return ImageFormat::Typeless;
+    }
+
     [[nodiscard]] virtual u32 ReadViewportTransformState() = 0;
 
     [[nodiscard]] virtual u32 TextureBoundBuffer() const = 0;
@@ -39,6 +47,14 @@ public:
     [[nodiscard]] virtual std::optional<ReplaceConstant> GetReplaceConstBuffer(u32 bank,
                                                                                u32 offset) = 0;
 
+    /// Value the program may be specialized for at the given constant buffer word, reads with an
+    /// immediate bank and offset are folded to it. Folded assumptions are listed in
+    /// Info::cbuf_assumptions, by default nothing is assumed.
+    [[nodiscard]] virtual std::optional<u32> GetCbufAssumption([[maybe_unused]] u32 bank,
+                                                               [[maybe_unused]] u32 offset) {
+        return std::nullopt;
+    }
+
     virtual void Dump(u64 hash) = 0;
 
     [[nodiscard]] const ProgramHeader& SPH() const noexcept {
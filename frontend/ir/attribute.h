@@ -3,6 +3,11 @@
 
 #pragma once
 
+#include <functional>
+#include <utility>
+
+#include <boost/container/flat_map.hpp>
+#include <boost/container/small_vector.hpp>
 #include <fmt/format.h>
 
 #include <shader_compiler/common/common_types.h>
@@ -230,6 +235,11 @@ constexpr size_t NUM_GENERICS = 32;
 
 constexpr size_t NUM_FIXEDFNCTEXTURE = 10;
 
+/// Sorted mapping between attributes, stored inline for the common amount of legacy varyings
+using AttributeMapping =
+    boost::container::flat_map<Attribute, Attribute, std::less<Attribute>,
+                               boost::container::small_vector<std::pair<Attribute, Attribute>, 8>>;
+
 [[nodiscard]] bool IsGeneric(Attribute attribute) noexcept;
 
 [[nodiscard]] u32 GenericAttributeIndex(Attribute attribute);
@@ -10,6 +10,7 @@
 
 #include <boost/intrusive/list.hpp>
 
+#include <shader_compiler/common/allocation_stats.h>
 #include <shader_compiler/common/bit_cast.h>
 #include <shader_compiler/common/common_types.h>
 #include <shader_compiler/frontend/ir/condition.h>
@@ -173,9 +174,9 @@ private:
     InstructionList instructions;
 
     /// Block immediate predecessors
-    std::vector<Block*> imm_predecessors;
+    std::vector<Block*, Allocation::CountingAllocator<Block*>> imm_predecessors;
     /// Block immediate successors
-    std::vector<Block*> imm_successors;
+    std::vector<Block*, Allocation::CountingAllocator<Block*>> imm_successors;
 
     /// Intrusively store the value of a register in the block.
     std::array<Value, NUM_REGS> ssa_reg_values;
@@ -4,12 +4,14 @@
 #pragma once
 
 #include <range/v3/algorithm.hpp>
+#include <deque>
 #include <optional>
 #include <type_traits>
 #include <queue>
 
 #include <boost/container/small_vector.hpp>
 
+#include <shader_compiler/common/allocation_stats.h>
 #include <shader_compiler/frontend/ir/value.h>
 
 namespace Shader::IR {
@@ -24,7 +26,8 @@ auto BreadthFirstSearch(const Value& value, Pred&& pred)
     // Breadth-first search visiting the right most arguments first
     // Small vector has been determined from shaders in Super Smash Bros. Ultimate
     boost::container::small_vector<const Inst*, 2> visited;
-    std::queue<const Inst*> queue;
+    std::queue<const Inst*, std::deque<const Inst*, Allocation::CountingAllocator<const Inst*>>>
+        queue;
     queue.push(value.InstRecursive());
 
     while (!queue.empty()) {
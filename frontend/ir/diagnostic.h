@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <shader_compiler/common/common_types.h>
+
+namespace Shader::IR {
+
+/// Unsupported construct that was replaced with a stub when compiling with stubbing enabled
+struct Diagnostic {
+    enum class Kind {
+        UnimplementedInstruction, ///< Guest instruction was translated as a no-op
+        UntrackedBindlessHandle,  ///< Bindless handle was bound to the first bound texture slot
+    };
+
+    Kind kind{};
+    std::optional<u32> pc;          ///< Byte offset of the guest instruction, when known
+    std::optional<u64> instruction; ///< Raw guest instruction word, when known
+    std::string opcode;             ///< Name of the guest or IR opcode
+    std::string message;
+};
+
+using Diagnostics = std::vector<Diagnostic>;
+
+} // namespace Shader::IR
@@ -3,6 +3,7 @@
 
 #include <shader_compiler/common/bit_cast.h>
 #include <shader_compiler/frontend/ir/ir_emitter.h>
+#include <shader_compiler/frontend/ir/lut3.h>
 #include <shader_compiler/frontend/ir/value.h>
 #include <shader_compiler/common/log.h>
 
@@ -799,6 +800,48 @@ F16F32F64 IREmitter::FPFma(const F16F32F64& a, const F16F32F64& b, const F16F32F
     }
 }
 
+Value IREmitter::FPAddPacked(const Value& a, const Value& b, FpControl control) {
+    if (a.Type() != b.Type()) {
+        throw InvalidArgument("Mismatching types {} and {}", a.Type(), b.Type());
+    }
+    switch (a.Type()) {
+    case Type::F16x2:
+        return Inst(Opcode::FPAdd16x2, Flags{control}, a, b);
+    case Type::F32x2:
+        return Inst(Opcode::FPAdd32x2, Flags{control}, a, b);
+    default:
+        ThrowInvalidType(a.Type());
+    }
+}
+
+Value IREmitter::FPMulPacked(const Value& a, const Value& b, FpControl control) {
+    if (a.Type() != b.Type()) {
+        throw InvalidArgument("Mismatching types {} and {}", a.Type(), b.Type());
+    }
+    switch (a.Type()) {
+    case Type::F16x2:
+        return Inst(Opcode::FPMul16x2, Flags{control}, a, b);
+    case Type::F32x2:
+        return Inst(Opcode::FPMul32x2, Flags{control}, a, b);
+    default:
+        ThrowInvalidType(a.Type());
+    }
+}
+
+Value IREmitter::FPFmaPacked(const Value& a, const Value& b, const Value& c, FpControl control) {
+    if (a.Type() != b.Type() || a.Type() != c.Type()) {
+        throw InvalidArgument("Mismatching types {}, {}, and {}", a.Type(), b.Type(), c.Type());
+    }
+    switch (a.Type()) {
+    case Type::F16x2:
+        return Inst(Opcode::FPFma16x2, Flags{control}, a, b, c);
+    case Type::F32x2:
+        return Inst(Opcode::FPFma32x2, Flags{control}, a, b, c);
+    default:
+        ThrowInvalidType(a.Type());
+    }
+}
+
 F16F32F64 IREmitter::FPAbs(const F16F32F64& value) {
     switch (value.Type()) {
     case Type::F16:
@@ -891,6 +934,17 @@ F16F32F64 IREmitter::FPSaturate(const F16F32F64& value) {
     }
 }
 
+Value IREmitter::FPSaturatePacked(const Value& value) {
+    switch (value.Type()) {
+    case Type::F16x2:
+        return Inst(Opcode::FPSaturate16x2, value);
+    case Type::F32x2:
+        return Inst(Opcode::FPSaturate32x2, value);
+    default:
+        ThrowInvalidType(value.Type());
+    }
+}
+
 F16F32F64 IREmitter::FPClamp(const F16F32F64& value, const F16F32F64& min_value,
                              const F16F32F64& max_value) {
     if (value.Type() != min_value.Type() || value.Type() != max_value.Type()) {
@@ -1234,6 +1288,32 @@ U32 IREmitter::BitwiseXor(const U32& a, const U32& b) {
     return Inst<U32>(Opcode::BitwiseXor32, a, b);
 }
 
+U32 IREmitter::BitwiseLut(const U32& a, const U32& b, const U32& c, u32 lut) {
+    if (Lut3OperationCount(lut) > 1) {
+        return Inst<U32>(Opcode::BitwiseLut32, a, b, c, Imm32(lut));
+    }
+    // Tables of a single operation keep their own opcode, so passes matching it keep working
+    struct Ops {
+        U32 And(const U32& lhs, const U32& rhs) {
+            return ir.BitwiseAnd(lhs, rhs);
+        }
+        U32 Or(const U32& lhs, const U32& rhs) {
+            return ir.BitwiseOr(lhs, rhs);
+        }
+        U32 Xor(const U32& lhs, const U32& rhs) {
+            return ir.BitwiseXor(lhs, rhs);
+        }
+        U32 Not(const U32& value) {
+            return ir.BitwiseNot(value);
+        }
+        U32 Imm(u32 value) {
+            return ir.Imm32(value);
+        }
+        IREmitter& ir;
+    } ops{*this};
+    return ApplyLut3(ops, a, b, c, lut);
+}
+
 U32 IREmitter::BitFieldInsert(const U32& base, const U32& insert, const U32& offset,
                               const U32& count) {
     return Inst<U32>(Opcode::BitFieldInsert, base, insert, offset, count);
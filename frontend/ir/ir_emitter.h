@@ -174,6 +174,13 @@ public:
     [[nodiscard]] F16F32F64 FPFma(const F16F32F64& a, const F16F32F64& b, const F16F32F64& c,
                                   FpControl control = {});
 
+    /// Two-lane operations on F16x2 or F32x2 vectors
+    [[nodiscard]] Value FPAddPacked(const Value& a, const Value& b, FpControl control = {});
+    [[nodiscard]] Value FPMulPacked(const Value& a, const Value& b, FpControl control = {});
+    [[nodiscard]] Value FPFmaPacked(const Value& a, const Value& b, const Value& c,
+                                    FpControl control = {});
+    [[nodiscard]] Value FPSaturatePacked(const Value& value);
+
     [[nodiscard]] F16F32F64 FPAbs(const F16F32F64& value);
     [[nodiscard]] F16F32F64 FPNeg(const F16F32F64& value);
     [[nodiscard]] F16F32F64 FPAbsNeg(const F16F32F64& value, bool abs, bool neg);
@@ -223,6 +230,7 @@ public:
     [[nodiscard]] U32 BitwiseAnd(const U32& a, const U32& b);
     [[nodiscard]] U32 BitwiseOr(const U32& a, const U32& b);
     [[nodiscard]] U32 BitwiseXor(const U32& a, const U32& b);
+    [[nodiscard]] U32 BitwiseLut(const U32& a, const U32& b, const U32& c, u32 lut);
     [[nodiscard]] U32 BitFieldInsert(const U32& base, const U32& insert, const U32& offset,
                                      const U32& count);
     [[nodiscard]] U32 BitFieldExtract(const U32& base, const U32& offset, const U32& count,
@@ -0,0 +1,563 @@
+// SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <shader_compiler/common/common_types.h>
+#include <shader_compiler/exception.h>
+
+namespace Shader::IR {
+
+/// Truth tables of the LOP3 inputs, a LUT equal to one of these is that input
+constexpr u32 LUT3_A{0xF0};
+constexpr u32 LUT3_B{0xCC};
+constexpr u32 LUT3_C{0xAA};
+
+// https://forums.developer.nvidia.com/t/reverse-lut-for-lop3-lut/110651
+/// Expands a three-input logic operation with an 8-bit truth table into the cheapest combination
+/// of two-input bitwise operations. Ops provides And, Or, Xor, Not and Imm over the values of the
+/// caller, so the IR and each backend expand the same table with their own operations.
+template <typename Ops, typename Value>
+Value ApplyLut3(Ops& ops, const Value& a, const Value& b, const Value& c, u32 lut) {
+    switch (lut) {
+        // generated code, do not edit manually
+    case 0:
+        return ops.Imm(0);
+    case 1:
+        return ops.Not(ops.Or(a, ops.Or(b, c)));
+    case 2:
+        return ops.And(c, ops.Not(ops.Or(a, b)));
+    case 3:
+        return ops.Not(ops.Or(a, b));
+    case 4:
+        return ops.And(b, ops.Not(ops.Or(a, c)));
+    case 5:
+        return ops.Not(ops.Or(a, c));
+    case 6:
+        return ops.And(ops.Not(a), ops.Xor(b, c));
+    case 7:
+        return ops.Not(ops.Or(a, ops.And(b, c)));
+    case 8:
+        return ops.And(ops.And(b, c), ops.Not(a));
+    case 9:
+        return ops.Not(ops.Or(a, ops.Xor(b, c)));
+    case 10:
+        return ops.And(c, ops.Not(a));
+    case 11:
+        return ops.And(ops.Not(a), ops.Or(c, ops.Not(b)));
+    case 12:
+        return ops.And(b, ops.Not(a));
+    case 13:
+        return ops.And(ops.Not(a), ops.Or(b, ops.Not(c)));
+    case 14:
+        return ops.And(ops.Not(a), ops.Or(b, c));
+    case 15:
+        return ops.Not(a);
+    case 16:
+        return ops.And(a, ops.Not(ops.Or(b, c)));
+    case 17:
+        return ops.Not(ops.Or(b, c));
+    case 18:
+        return ops.And(ops.Not(b), ops.Xor(a, c));
+    case 19:
+        return ops.Not(ops.Or(b, ops.And(a, c)));
+    case 20:
+        return ops.And(ops.Not(c), ops.Xor(a, b));
+    case 21:
+        return ops.Not(ops.Or(c, ops.And(a, b)));
+    case 22:
+        return ops.Xor(ops.Or(a, b), ops.Or(c, ops.And(a, b)));
+    case 23:
+        return ops.Xor(ops.And(ops.Xor(a, b), ops.Xor(a, c)), ops.Not(a));
+    case 24:
+        return ops.And(ops.Xor(a, b), ops.Xor(a, c));
+    case 25:
+        return ops.Not(ops.Or(ops.And(a, b), ops.Xor(b, c)));
+    case 26:
+        return ops.And(ops.Or(c, ops.Not(b)), ops.Xor(a, c));
+    case 27:
+        return ops.Xor(ops.Or(a, ops.Not(c)), ops.Or(b, c));
+    case 28:
+        return ops.And(ops.Or(b, ops.Not(c)), ops.Xor(a, b));
+    case 29:
+        return ops.Xor(ops.Or(a, ops.Not(b)), ops.Or(b, c));
+    case 30:
+        return ops.Xor(a, ops.Or(b, c));
+    case 31:
+        return ops.Not(ops.And(a, ops.Or(b, c)));
+    case 32:
+        return ops.And(ops.And(a, c), ops.Not(b));
+    case 33:
+        return ops.Not(ops.Or(b, ops.Xor(a, c)));
+    case 34:
+        return ops.And(c, ops.Not(b));
+    case 35:
+        return ops.And(ops.Not(b), ops.Or(c, ops.Not(a)));
+    case 36:
+        return ops.And(ops.Xor(a, b), ops.Xor(b, c));
+    case 37:
+        return ops.Not(ops.Or(ops.And(a, b), ops.Xor(a, c)));
+    case 38:
+        return ops.And(ops.Or(c, ops.Not(a)), ops.Xor(b, c));
+    case 39:
+        return ops.Xor(ops.Or(a, c), ops.Or(b, ops.Not(c)));
+    case 40:
+        return ops.And(c, ops.Xor(a, b));
+    case 41:
+        return ops.Xor(ops.Or(a, b), ops.Or(ops.And(a, b), ops.Not(c)));
+    case 42:
+        return ops.And(c, ops.Not(ops.And(a, b)));
+    case 43:
+        return ops.Xor(ops.Or(a, ops.Not(c)), ops.Or(b, ops.Xor(a, c)));
+    case 44:
+        return ops.And(ops.Or(b, c), ops.Xor(a, b));
+    case 45:
+        return ops.Xor(a, ops.Or(b, ops.Not(c)));
+    case 46:
+        return ops.Xor(ops.And(a, b), ops.Or(b, c));
+    case 47:
+        return ops.Or(ops.And(c, ops.Not(b)), ops.Not(a));
+    case 48:
+        return ops.And(a, ops.Not(b));
+    case 49:
+        return ops.And(ops.Not(b), ops.Or(a, ops.Not(c)));
+    case 50:
+        return ops.And(ops.Not(b), ops.Or(a, c));
+    case 51:
+        return ops.Not(b);
+    case 52:
+        return ops.And(ops.Or(a, ops.Not(c)), ops.Xor(a, b));
+    case 53:
+        return ops.Xor(ops.Or(a, c), ops.Or(b, ops.Not(a)));
+    case 54:
+        return ops.Xor(b, ops.Or(a, c));
+    case 55:
+        return ops.Not(ops.And(b, ops.Or(a, c)));
+    case 56:
+        return ops.And(ops.Or(a, c), ops.Xor(a, b));
+    case 57:
+        return ops.Xor(b, ops.Or(a, ops.Not(c)));
+    case 58:
+        return ops.Xor(ops.And(a, b), ops.Or(a, c));
+    case 59:
+        return ops.Or(ops.And(c, ops.Not(a)), ops.Not(b));
+    case 60:
+        return ops.Xor(a, b);
+    case 61:
+        return ops.Or(ops.Not(ops.Or(a, c)), ops.Xor(a, b));
+    case 62:
+        return ops.Or(ops.And(c, ops.Not(a)), ops.Xor(a, b));
+    case 63:
+        return ops.Not(ops.And(a, b));
+    case 64:
+        return ops.And(ops.And(a, b), ops.Not(c));
+    case 65:
+        return ops.Not(ops.Or(c, ops.Xor(a, b)));
+    case 66:
+        return ops.And(ops.Xor(a, c), ops.Xor(b, c));
+    case 67:
+        return ops.Not(ops.Or(ops.And(a, c), ops.Xor(a, b)));
+    case 68:
+        return ops.And(b, ops.Not(c));
+    case 69:
+        return ops.And(ops.Not(c), ops.Or(b, ops.Not(a)));
+    case 70:
+        return ops.And(ops.Or(b, ops.Not(a)), ops.Xor(b, c));
+    case 71:
+        return ops.Xor(ops.Or(a, b), ops.Or(c, ops.Not(b)));
+    case 72:
+        return ops.And(b, ops.Xor(a, c));
+    case 73:
+        return ops.Xor(ops.Or(a, c), ops.Or(ops.And(a, c), ops.Not(b)));
+    case 74:
+        return ops.And(ops.Or(b, c), ops.Xor(a, c));
+    case 75:
+        return ops.Xor(a, ops.Or(c, ops.Not(b)));
+    case 76:
+        return ops.And(b, ops.Not(ops.And(a, c)));
+    case 77:
+        return ops.Xor(ops.Or(a, ops.Not(b)), ops.Or(c, ops.Xor(a, b)));
+    case 78:
+        return ops.Xor(ops.And(a, c), ops.Or(b, c));
+    case 79:
+        return ops.Or(ops.And(b, ops.Not(c)), ops.Not(a));
+    case 80:
+        return ops.And(a, ops.Not(c));
+    case 81:
+        return ops.And(ops.Not(c), ops.Or(a, ops.Not(b)));
+    case 82:
+        return ops.And(ops.Or(a, ops.Not(b)), ops.Xor(a, c));
+    case 83:
+        return ops.Xor(ops.Or(a, b), ops.Or(c, ops.Not(a)));
+    case 84:
+        return ops.And(ops.Not(c), ops.Or(a, b));
+    case 85:
+        return ops.Not(c);
+    case 86:
+        return ops.Xor(c, ops.Or(a, b));
+    case 87:
+        return ops.Not(ops.And(c, ops.Or(a, b)));
+    case 88:
+        return ops.And(ops.Or(a, b), ops.Xor(a, c));
+    case 89:
+        return ops.Xor(c, ops.Or(a, ops.Not(b)));
+    case 90:
+        return ops.Xor(a, c);
+    case 91:
+        return ops.Or(ops.Not(ops.Or(a, b)), ops.Xor(a, c));
+    case 92:
+        return ops.Xor(ops.And(a, c), ops.Or(a, b));
+    case 93:
+        return ops.Or(ops.And(b, ops.Not(a)), ops.Not(c));
+    case 94:
+        return ops.Or(ops.And(b, ops.Not(a)), ops.Xor(a, c));
+    case 95:
+        return ops.Not(ops.And(a, c));
+    case 96:
+        return ops.And(a, ops.Xor(b, c));
+    case 97:
+        return ops.Xor(ops.Or(b, c), ops.Or(ops.And(b, c), ops.Not(a)));
+    case 98:
+        return ops.And(ops.Or(a, c), ops.Xor(b, c));
+    case 99:
+        return ops.Xor(b, ops.Or(c, ops.Not(a)));
+    case 100:
+        return ops.And(ops.Or(a, b), ops.Xor(b, c));
+    case 101:
+        return ops.Xor(c, ops.Or(b, ops.Not(a)));
+    case 102:
+        return ops.Xor(b, c);
+    case 103:
+        return ops.Or(ops.Not(ops.Or(a, b)), ops.Xor(b, c));
+    case 104:
+        return ops.And(ops.Or(a, b), ops.Xor(c, ops.And(a, b)));
+    case 105:
+        return ops.Xor(ops.Not(a), ops.Xor(b, c));
+    case 106:
+        return ops.Xor(c, ops.And(a, b));
+    case 107:
+        return ops.Xor(ops.And(c, ops.Or(a, b)), ops.Xor(a, ops.Not(b)));
+    case 108:
+        return ops.Xor(b, ops.And(a, c));
+    case 109:
+        return ops.Xor(ops.And(b, ops.Or(a, c)), ops.Xor(a, ops.Not(c)));
+    case 110:
+        return ops.Or(ops.And(b, ops.Not(a)), ops.Xor(b, c));
+    case 111:
+        return ops.Or(ops.Not(a), ops.Xor(b, c));
+    case 112:
+        return ops.And(a, ops.Not(ops.And(b, c)));
+    case 113:
+        return ops.Xor(ops.Or(b, ops.Not(a)), ops.Or(c, ops.Xor(a, b)));
+    case 114:
+        return ops.Xor(ops.And(b, c), ops.Or(a, c));
+    case 115:
+        return ops.Or(ops.And(a, ops.Not(c)), ops.Not(b));
+    case 116:
+        return ops.Xor(ops.And(b, c), ops.Or(a, b));
+    case 117:
+        return ops.Or(ops.And(a, ops.Not(b)), ops.Not(c));
+    case 118:
+        return ops.Or(ops.And(a, ops.Not(b)), ops.Xor(b, c));
+    case 119:
+        return ops.Not(ops.And(b, c));
+    case 120:
+        return ops.Xor(a, ops.And(b, c));
+    case 121:
+        return ops.Xor(ops.And(a, ops.Or(b, c)), ops.Xor(b, ops.Not(c)));
+    case 122:
+        return ops.Or(ops.And(a, ops.Not(b)), ops.Xor(a, c));
+    case 123:
+        return ops.Or(ops.Not(b), ops.Xor(a, c));
+    case 124:
+        return ops.Or(ops.And(a, ops.Not(c)), ops.Xor(a, b));
+    case 125:
+        return ops.Or(ops.Not(c), ops.Xor(a, b));
+    case 126:
+        return ops.Or(ops.Xor(a, b), ops.Xor(a, c));
+    case 127:
+        return ops.Not(ops.And(a, ops.And(b, c)));
+    case 128:
+        return ops.And(a, ops.And(b, c));
+    case 129:
+        return ops.Not(ops.Or(ops.Xor(a, b), ops.Xor(a, c)));
+    case 130:
+        return ops.And(c, ops.Xor(a, ops.Not(b)));
+    case 131:
+        return ops.And(ops.Or(c, ops.Not(a)), ops.Xor(a, ops.Not(b)));
+    case 132:
+        return ops.And(b, ops.Xor(a, ops.Not(c)));
+    case 133:
+        return ops.And(ops.Or(b, ops.Not(a)), ops.Xor(a, ops.Not(c)));
+    case 134:
+        return ops.And(ops.Or(b, c), ops.Xor(a, ops.Xor(b, c)));
+    case 135:
+        return ops.Xor(ops.And(b, c), ops.Not(a));
+    case 136:
+        return ops.And(b, c);
+    case 137:
+        return ops.And(ops.Or(b, ops.Not(a)), ops.Xor(b, ops.Not(c)));
+    case 138:
+        return ops.And(c, ops.Or(b, ops.Not(a)));
+    case 139:
+        return ops.Or(ops.And(b, c), ops.Not(ops.Or(a, b)));
+    case 140:
+        return ops.And(b, ops.Or(c, ops.Not(a)));
+    case 141:
+        return ops.Or(ops.And(b, c), ops.Not(ops.Or(a, c)));
+    case 142:
+        return ops.Xor(a, ops.Or(ops.Xor(a, b), ops.Xor(a, c)));
+    case 143:
+        return ops.Or(ops.And(b, c), ops.Not(a));
+    case 144:
+        return ops.And(a, ops.Xor(b, ops.Not(c)));
+    case 145:
+        return ops.And(ops.Or(a, ops.Not(b)), ops.Xor(b, ops.Not(c)));
+    case 146:
+        return ops.And(ops.Or(a, c), ops.Xor(a, ops.Xor(b, c)));
+    case 147:
+        return ops.Xor(ops.And(a, c), ops.Not(b));
+    case 148:
+        return ops.And(ops.Or(a, b), ops.Xor(a, ops.Xor(b, c)));
+    case 149:
+        return ops.Xor(ops.And(a, b), ops.Not(c));
+    case 150:
+        return ops.Xor(a, ops.Xor(b, c));
+    case 151:
+        return ops.Or(ops.Not(ops.Or(a, b)), ops.Xor(a, ops.Xor(b, c)));
+    case 152:
+        return ops.And(ops.Or(a, b), ops.Xor(b, ops.Not(c)));
+    case 153:
+        return ops.Xor(b, ops.Not(c));
+    case 154:
+        return ops.Xor(c, ops.And(a, ops.Not(b)));
+    case 155:
+        return ops.Not(ops.And(ops.Or(a, b), ops.Xor(b, c)));
+    case 156:
+        return ops.Xor(b, ops.And(a, ops.Not(c)));
+    case 157:
+        return ops.Not(ops.And(ops.Or(a, c), ops.Xor(b, c)));
+    case 158:
+        return ops.Or(ops.And(b, c), ops.Xor(a, ops.Or(b, c)));
+    case 159:
+        return ops.Not(ops.And(a, ops.Xor(b, c)));
+    case 160:
+        return ops.And(a, c);
+    case 161:
+        return ops.And(ops.Or(a, ops.Not(b)), ops.Xor(a, ops.Not(c)));
+    case 162:
+        return ops.And(c, ops.Or(a, ops.Not(b)));
+    case 163:
+        return ops.Or(ops.And(a, c), ops.Not(ops.Or(a, b)));
+    case 164:
+        return ops.And(ops.Or(a, b), ops.Xor(a, ops.Not(c)));
+    case 165:
+        return ops.Xor(a, ops.Not(c));
+    case 166:
+        return ops.Xor(c, ops.And(b, ops.Not(a)));
+    case 167:
+        return ops.Not(ops.And(ops.Or(a, b), ops.Xor(a, c)));
+    case 168:
+        return ops.And(c, ops.Or(a, b));
+    case 169:
+        return ops.Xor(ops.Not(c), ops.Or(a, b));
+    case 170:
+        return c;
+    case 171:
+        return ops.Or(c, ops.Not(ops.Or(a, b)));
+    case 172:
+        return ops.And(ops.Or(a, b), ops.Or(c, ops.Not(a)));
+    case 173:
+        return ops.Or(ops.And(b, c), ops.Xor(a, ops.Not(c)));
+    case 174:
+        return ops.Or(c, ops.And(b, ops.Not(a)));
+    case 175:
+        return ops.Or(c, ops.Not(a));
+    case 176:
+        return ops.And(a, ops.Or(c, ops.Not(b)));
+    case 177:
+        return ops.Or(ops.And(a, c), ops.Not(ops.Or(b, c)));
+    case 178:
+        return ops.Xor(b, ops.Or(ops.Xor(a, b), ops.Xor(a, c)));
+    case 179:
+        return ops.Or(ops.And(a, c), ops.Not(b));
+    case 180:
+        return ops.Xor(a, ops.And(b, ops.Not(c)));
+    case 181:
+        return ops.Not(ops.And(ops.Or(b, c), ops.Xor(a, c)));
+    case 182:
+        return ops.Or(ops.And(a, c), ops.Xor(b, ops.Or(a, c)));
+    case 183:
+        return ops.Not(ops.And(b, ops.Xor(a, c)));
+    case 184:
+        return ops.And(ops.Or(a, b), ops.Or(c, ops.Not(b)));
+    case 185:
+        return ops.Or(ops.And(a, c), ops.Xor(b, ops.Not(c)));
+    case 186:
+        return ops.Or(c, ops.And(a, ops.Not(b)));
+    case 187:
+        return ops.Or(c, ops.Not(b));
+    case 188:
+        return ops.Or(ops.And(a, c), ops.Xor(a, b));
+    case 189:
+        return ops.Or(ops.Xor(a, b), ops.Xor(a, ops.Not(c)));
+    case 190:
+        return ops.Or(c, ops.Xor(a, b));
+    case 191:
+        return ops.Or(c, ops.Not(ops.And(a, b)));
+    case 192:
+        return ops.And(a, b);
+    case 193:
+        return ops.And(ops.Or(a, ops.Not(c)), ops.Xor(a, ops.Not(b)));
+    case 194:
+        return ops.And(ops.Or(a, c), ops.Xor(a, ops.Not(b)));
+    case 195:
+        return ops.Xor(a, ops.Not(b));
+    case 196:
+        return ops.And(b, ops.Or(a, ops.Not(c)));
+    case 197:
+        return ops.Or(ops.And(a, b), ops.Not(ops.Or(a, c)));
+    case 198:
+        return ops.Xor(b, ops.And(c, ops.Not(a)));
+    case 199:
+        return ops.Not(ops.And(ops.Or(a, c), ops.Xor(a, b)));
+    case 200:
+        return ops.And(b, ops.Or(a, c));
+    case 201:
+        return ops.Xor(ops.Not(b), ops.Or(a, c));
+    case 202:
+        return ops.And(ops.Or(a, c), ops.Or(b, ops.Not(a)));
+    case 203:
+        return ops.Or(ops.And(b, c), ops.Xor(a, ops.Not(b)));
+    case 204:
+        return b;
+    case 205:
+        return ops.Or(b, ops.Not(ops.Or(a, c)));
+    case 206:
+        return ops.Or(b, ops.And(c, ops.Not(a)));
+    case 207:
+        return ops.Or(b, ops.Not(a));
+    case 208:
+        return ops.And(a, ops.Or(b, ops.Not(c)));
+    case 209:
+        return ops.Or(ops.And(a, b), ops.Not(ops.Or(b, c)));
+    case 210:
+        return ops.Xor(a, ops.And(c, ops.Not(b)));
+    case 211:
+        return ops.Not(ops.And(ops.Or(b, c), ops.Xor(a, b)));
+    case 212:
+        return ops.Xor(c, ops.Or(ops.Xor(a, b), ops.Xor(a, c)));
+    case 213:
+        return ops.Or(ops.And(a, b), ops.Not(c));
+    case 214:
+        return ops.Or(ops.And(a, b), ops.Xor(c, ops.Or(a, b)));
+    case 215:
+        return ops.Not(ops.And(c, ops.Xor(a, b)));
+    case 216:
+        return ops.And(ops.Or(a, c), ops.Or(b, ops.Not(c)));
+    case 217:
+        return ops.Or(ops.And(a, b), ops.Xor(b, ops.Not(c)));
+    case 218:
+        return ops.Or(ops.And(a, b), ops.Xor(a, c));
+    case 219:
+        return ops.Or(ops.Xor(a, c), ops.Xor(a, ops.Not(b)));
+    case 220:
+        return ops.Or(b, ops.And(a, ops.Not(c)));
+    case 221:
+        return ops.Or(b, ops.Not(c));
+    case 222:
+        return ops.Or(b, ops.Xor(a, c));
+    case 223:
+        return ops.Or(b, ops.Not(ops.And(a, c)));
+    case 224:
+        return ops.And(a, ops.Or(b, c));
+    case 225:
+        return ops.Xor(ops.Not(a), ops.Or(b, c));
+    case 226:
+        return ops.And(ops.Or(a, ops.Not(b)), ops.Or(b, c));
+    case 227:
+        return ops.Or(ops.And(a, c), ops.Xor(a, ops.Not(b)));
+    case 228:
+        return ops.And(ops.Or(a, ops.Not(c)), ops.Or(b, c));
+    case 229:
+        return ops.Or(ops.And(a, b), ops.Xor(a, ops.Not(c)));
+    case 230:
+        return ops.Or(ops.And(a, b), ops.Xor(b, c));
+    case 231:
+        return ops.Or(ops.Xor(a, ops.Not(b)), ops.Xor(b, c));
+    case 232:
+        return ops.And(ops.Or(a, b), ops.Or(c, ops.And(a, b)));
+    case 233:
+        return ops.Or(ops.And(a, b), ops.Xor(ops.Not(c), ops.Or(a, b)));
+    case 234:
+        return ops.Or(c, ops.And(a, b));
+    case 235:
+        return ops.Or(c, ops.Xor(a, ops.Not(b)));
+    case 236:
+        return ops.Or(b, ops.And(a, c));
+    case 237:
+        return ops.Or(b, ops.Xor(a, ops.Not(c)));
+    case 238:
+        return ops.Or(b, c);
+    case 239:
+        return ops.Or(ops.Not(a), ops.Or(b, c));
+    case 240:
+        return a;
+    case 241:
+        return ops.Or(a, ops.Not(ops.Or(b, c)));
+    case 242:
+        return ops.Or(a, ops.And(c, ops.Not(b)));
+    case 243:
+        return ops.Or(a, ops.Not(b));
+    case 244:
+        return ops.Or(a, ops.And(b, ops.Not(c)));
+    case 245:
+        return ops.Or(a, ops.Not(c));
+    case 246:
+        return ops.Or(a, ops.Xor(b, c));
+    case 247:
+        return ops.Or(a, ops.Not(ops.And(b, c)));
+    case 248:
+        return ops.Or(a, ops.And(b, c));
+    case 249:
+        return ops.Or(a, ops.Xor(b, ops.Not(c)));
+    case 250:
+        return ops.Or(a, c);
+    case 251:
+        return ops.Or(ops.Not(b), ops.Or(a, c));
+    case 252:
+        return ops.Or(a, b);
+    case 253:
+        return ops.Or(ops.Not(c), ops.Or(a, b));
+    case 254:
+        return ops.Or(a, ops.Or(b, c));
+    case 255:
+        return ops.Imm(0xFFFFFFFF);
+        // end of generated code
+    }
+    throw InvalidArgument("LOP3 with out of range ttbl {}", lut);
+}
+
+/// Number of operations ApplyLut3 emits for the given truth table
+[[nodiscard]] inline u32 Lut3OperationCount(u32 lut) {
+    struct CountOps {
+        u32 And(u32 lhs, u32 rhs) {
+            return lhs + rhs + 1;
+        }
+        u32 Or(u32 lhs, u32 rhs) {
+            return lhs + rhs + 1;
+        }
+        u32 Xor(u32 lhs, u32 rhs) {
+            return lhs + rhs + 1;
+        }
+        u32 Not(u32 value) {
+            return value + 1;
+        }
+        u32 Imm(u32) {
+            return 0;
+        }
+    } ops;
+    return ApplyLut3(ops, 0U, 0U, 0U, lut);
+}
+
+} // namespace Shader::IR
@@ -5,10 +5,10 @@ from itertools import product
 
 # The primitive instructions
 OPS = {
-    'ir.BitwiseAnd({}, {})' : (2, 1, lambda a,b: a&b),
-    'ir.BitwiseOr({}, {})' : (2, 1, lambda a,b: a|b),
-    'ir.BitwiseXor({}, {})' : (2, 1, lambda a,b: a^b),
-    'ir.BitwiseNot({})' : (1, 0.1, lambda a: (~a) & 255), # Only tiny cost, as this can often inlined in other instructions
+    'ops.And({}, {})' : (2, 1, lambda a,b: a&b),
+    'ops.Or({}, {})' : (2, 1, lambda a,b: a|b),
+    'ops.Xor({}, {})' : (2, 1, lambda a,b: a^b),
+    'ops.Not({})' : (1, 0.1, lambda a: (~a) & 255), # Only tiny cost, as this can often inlined in other instructions
 }
 
 # Our database of combination of instructions
@@ -45,8 +45,8 @@ def register(imm, instruction, count, latency):
     return False
 
 # Constants: 0, 1 (for free)
-register(0, 'ir.Imm32(0)', 0, 0)
-register(255, 'ir.Imm32(0xFFFFFFFF)', 0, 0)
+register(0, 'ops.Imm(0)', 0, 0)
+register(255, 'ops.Imm(0xFFFFFFFF)', 0, 0)
 
 # Inputs: a, b, c (for free)
 ta = 0xF0
@@ -59,7 +59,7 @@ inputs = {
 }
 for imm, instruction in inputs.items():
     register(imm, instruction, 0, 0)
-    register((~imm) & 255, 'ir.BitwiseNot({})'.format(instruction), 0.099, 0.099) # slightly cheaper NEG on inputs
+    register((~imm) & 255, 'ops.Not({})'.format(instruction), 0.099, 0.099) # slightly cheaper NEG on inputs
 
 # Try to combine two values from the db with an instruction.
 # If it is better than the old method, update it.
@@ -83,7 +83,7 @@ while True:
         # No update at all? So terminate
         break
 
-# Hacky output. Please improve me to output valid C++ instead.
+# Hacky output for the switch in ApplyLut3 (lut3.h). Please improve me to output valid C++ instead.
 s = """    case {imm}:
         return {op};"""
 for imm in range(256):
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <memory>
 
+#include <shader_compiler/common/allocation_stats.h>
 #include <shader_compiler/exception.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
 #include <shader_compiler/frontend/ir/type.h>
@@ -35,6 +36,7 @@ void RemovePseudoInstruction(IR::Inst*& inst, IR::Opcode expected_opcode) {
 void AllocAssociatedInsts(std::unique_ptr<AssociatedInsts>& associated_insts) {
     if (!associated_insts) {
         associated_insts = std::make_unique<AssociatedInsts>();
+        Allocation::Record(sizeof(AssociatedInsts));
     }
 }
 } // Anonymous namespace
@@ -119,6 +121,14 @@ bool Inst::MayHaveSideEffects() const noexcept {
     case Opcode::SharedAtomicExchange32:
     case Opcode::SharedAtomicExchange64:
     case Opcode::SharedAtomicExchange32x2:
+    case Opcode::SharedAtomicAggregatedIAdd32:
+    case Opcode::SharedAtomicAggregatedSMin32:
+    case Opcode::SharedAtomicAggregatedUMin32:
+    case Opcode::SharedAtomicAggregatedSMax32:
+    case Opcode::SharedAtomicAggregatedUMax32:
+    case Opcode::SharedAtomicAggregatedAnd32:
+    case Opcode::SharedAtomicAggregatedOr32:
+    case Opcode::SharedAtomicAggregatedXor32:
     case Opcode::GlobalAtomicIAdd32:
     case Opcode::GlobalAtomicSMin32:
     case Opcode::GlobalAtomicUMin32:
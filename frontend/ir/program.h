@@ -6,8 +6,10 @@
 #include <array>
 #include <string>
 
+#include <shader_compiler/common/allocation_stats.h>
 #include <shader_compiler/frontend/ir/abstract_syntax_list.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
+#include <shader_compiler/frontend/ir/diagnostic.h>
 #include <shader_compiler/program_header.h>
 #include <shader_compiler/shader_info.h>
 #include <shader_compiler/stage.h>
@@ -27,6 +29,13 @@ struct Program {
     u32 local_memory_size{};
     u32 shared_memory_size{};
     bool is_geometry_passthrough{};
+    /// Hash of the guest code the program was translated from, see Flow::CFG::CodeHash
+    /// Zero for generated programs
+    u64 code_hash{};
+    /// Heap allocations made by the compiler while producing and emitting this program
+    AllocationStats allocation_stats;
+    /// Constructs replaced with stubs, only populated when HostTranslateInfo::stub_unimplemented is set
+    Diagnostics diagnostics;
 };
 
 [[nodiscard]] std::string DumpProgram(const Program& program);
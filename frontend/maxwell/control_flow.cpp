@@ -10,6 +10,8 @@
 
 #include <fmt/format.h>
 
+#include <shader_compiler/common/hash.h>
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/exception.h>
 #include <shader_compiler/frontend/maxwell/control_flow.h>
 #include <shader_compiler/frontend/maxwell/decode.h>
@@ -32,6 +34,110 @@ struct Compare {
     }
 };
 
+/// Longest run of predicated instructions executed with selects, longer ones are branched over
+constexpr size_t MAX_INLINE_PREDICATED_RUN{3};
+
+/// True for instructions without side effects other than register, predicate and flag writes,
+/// these can be executed unconditionally with their writes selected by the predicate
+bool IsSelectable(Instruction inst) {
+    Opcode opcode{};
+    try {
+        opcode = Decode(inst.raw);
+    } catch (const NotImplementedException&) {
+        return false;
+    }
+    switch (opcode) {
+    case Opcode::BFE_reg:
+    case Opcode::BFE_cbuf:
+    case Opcode::BFE_imm:
+    case Opcode::BFI_reg:
+    case Opcode::BFI_rc:
+    case Opcode::BFI_cr:
+    case Opcode::BFI_imm:
+    case Opcode::F2F_reg:
+    case Opcode::F2F_cbuf:
+    case Opcode::F2F_imm:
+    case Opcode::F2I_reg:
+    case Opcode::F2I_cbuf:
+    case Opcode::F2I_imm:
+    case Opcode::FADD_reg:
+    case Opcode::FADD_cbuf:
+    case Opcode::FADD_imm:
+    case Opcode::FADD32I:
+    case Opcode::FFMA_reg:
+    case Opcode::FFMA_rc:
+    case Opcode::FFMA_cr:
+    case Opcode::FFMA_imm:
+    case Opcode::FFMA32I:
+    case Opcode::FMNMX_reg:
+    case Opcode::FMNMX_cbuf:
+    case Opcode::FMNMX_imm:
+    case Opcode::FMUL_reg:
+    case Opcode::FMUL_cbuf:
+    case Opcode::FMUL_imm:
+    case Opcode::FMUL32I:
+    case Opcode::FSETP_reg:
+    case Opcode::FSETP_cbuf:
+    case Opcode::FSETP_imm:
+    case Opcode::I2F_reg:
+    case Opcode::I2F_cbuf:
+    case Opcode::I2F_imm:
+    case Opcode::I2I_reg:
+    case Opcode::I2I_cbuf:
+    case Opcode::I2I_imm:
+    case Opcode::IADD_reg:
+    case Opcode::IADD_cbuf:
+    case Opcode::IADD_imm:
+    case Opcode::IADD3_reg:
+    case Opcode::IADD3_cbuf:
+    case Opcode::IADD3_imm:
+    case Opcode::IADD32I:
+    case Opcode::IMNMX_reg:
+    case Opcode::IMNMX_cbuf:
+    case Opcode::IMNMX_imm:
+    case Opcode::ISCADD_reg:
+    case Opcode::ISCADD_cbuf:
+    case Opcode::ISCADD_imm:
+    case Opcode::ISCADD32I:
+    case Opcode::ISETP_reg:
+    case Opcode::ISETP_cbuf:
+    case Opcode::ISETP_imm:
+    case Opcode::LOP_reg:
+    case Opcode::LOP_cbuf:
+    case Opcode::LOP_imm:
+    case Opcode::LOP3_reg:
+    case Opcode::LOP3_cbuf:
+    case Opcode::LOP3_imm:
+    case Opcode::LOP32I:
+    case Opcode::MOV_reg:
+    case Opcode::MOV_cbuf:
+    case Opcode::MOV_imm:
+    case Opcode::MOV32I:
+    case Opcode::MUFU:
+    case Opcode::PRMT_reg:
+    case Opcode::PRMT_rc:
+    case Opcode::PRMT_cr:
+    case Opcode::PRMT_imm:
+    case Opcode::PSETP:
+    case Opcode::SEL_reg:
+    case Opcode::SEL_cbuf:
+    case Opcode::SEL_imm:
+    case Opcode::SHL_reg:
+    case Opcode::SHL_cbuf:
+    case Opcode::SHL_imm:
+    case Opcode::SHR_reg:
+    case Opcode::SHR_cbuf:
+    case Opcode::SHR_imm:
+    case Opcode::XMAD_reg:
+    case Opcode::XMAD_rc:
+    case Opcode::XMAD_cr:
+    case Opcode::XMAD_imm:
+        return true;
+    default:
+        return false;
+    }
+}
+
 u32 BranchOffset(Location pc, Instruction inst) {
     return pc.Offset() + static_cast<u32>(inst.branch.Offset()) + 8u;
 }
@@ -188,6 +294,8 @@ CFG::CFG(Environment& env_, ObjectPool<Block>& block_pool_, Location start_addre
          bool exits_to_dispatcher_)
     : env{env_}, block_pool{block_pool_}, program_start{start_address}, exits_to_dispatcher{
                                                                             exits_to_dispatcher_} {
+    SHADER_TRACE_SCOPE("CFG");
+    Allocation::Scope allocation_scope{allocation_stats, CompilePhase::ControlFlow};
     if (exits_to_dispatcher) {
         dispatch_block = block_pool.Create(Block{});
         dispatch_block->begin = {};
@@ -200,6 +308,7 @@ CFG::CFG(Environment& env_, ObjectPool<Block>& block_pool_, Location start_addre
     }
     functions.emplace_back(block_pool, start_address);
     for (FunctionId function_id = 0; function_id < functions.size(); ++function_id) {
+        SHADER_TRACE_SCOPE("CFG::AnalyzeFunction", static_cast<u32>(function_id));
         while (!functions[function_id].labels.empty()) {
             Function& function{functions[function_id]};
             Label label{function.labels.back()};
@@ -215,6 +324,24 @@ CFG::CFG(Environment& env_, ObjectPool<Block>& block_pool_, Location start_addre
     }
 }
 
+u64 CFG::CodeHash() const {
+    SHADER_TRACE_SCOPE("CFG::CodeHash");
+    boost::container::small_vector<u64, 1024> words;
+    for (const Function& function : functions) {
+        for (const Block& block : function.blocks) {
+            if (block.begin == block.end || block.begin.IsVirtual()) {
+                continue;
+            }
+            // Relative branches are position dependent, so the layout is part of the key
+            words.push_back((u64{block.begin.Offset()} << 32) | block.end.Offset());
+            for (Location pc = block.begin; pc != block.end; ++pc) {
+                words.push_back(env.ReadInstruction(pc.Offset()));
+            }
+        }
+    }
+    return HashWords({words.data(), words.size()});
+}
+
 void CFG::AnalyzeLabel(FunctionId function_id, Label& label) {
     if (InspectVisitedBlocks(function_id, label)) {
         // Label address has been visited
@@ -271,7 +398,13 @@ bool CFG::InspectVisitedBlocks(FunctionId function_id, const Label& label) {
 
 CFG::AnalysisState CFG::AnalyzeInst(Block* block, FunctionId function_id, Location pc) {
     const Instruction inst{env.ReadInstruction(pc.Offset())};
-    const Opcode opcode{Decode(inst.raw)};
+    Opcode opcode{};
+    try {
+        opcode = Decode(inst.raw);
+    } catch (const NotImplementedException&) {
+        // Unknown encodings are treated as plain instructions, translation reports or stubs them
+        return AnalysisState::Continue;
+    }
     switch (opcode) {
     case Opcode::BRA:
     case Opcode::JMP:
@@ -351,6 +484,10 @@ CFG::AnalysisState CFG::AnalyzeInst(Block* block, FunctionId function_id, Locati
     if (pred == Predicate{true} || pred == Predicate{false}) {
         return AnalysisState::Continue;
     }
+    if (IsPredicatedInline(env, pc)) {
+        // Translated with selects on its destinations, no conditional block is needed
+        return AnalysisState::Continue;
+    }
     const IR::Condition cond{static_cast<IR::Pred>(pred.index), pred.negated};
     AnalyzeCondInst(block, function_id, pc, EndClass::Branch, cond);
     return AnalysisState::Branch;
@@ -639,4 +776,23 @@ std::string CFG::Dot() const {
     return dot;
 }
 
+bool IsPredicatedInline(Environment& env, Location pc) {
+    const Instruction inst{env.ReadInstruction(pc.Offset())};
+    const Predicate pred{inst.Pred()};
+    if (pred == Predicate{true} || pred == Predicate{false} || !IsSelectable(inst)) {
+        return false;
+    }
+    // Only the run from this instruction onwards is measured, so the tail of a long run is
+    // inlined while its head keeps its conditional blocks
+    size_t run_length{1};
+    for (Location next = pc + 1; run_length <= MAX_INLINE_PREDICATED_RUN; ++next) {
+        const Instruction next_inst{env.ReadInstruction(next.Offset())};
+        if (next_inst.Pred() != pred || !IsSelectable(next_inst)) {
+            break;
+        }
+        ++run_length;
+    }
+    return run_length <= MAX_INLINE_PREDICATED_RUN;
+}
+
 } // namespace Shader::Maxwell::Flow
@@ -11,6 +11,7 @@
 #include <boost/container/small_vector.hpp>
 #include <boost/intrusive/set.hpp>
 
+#include <shader_compiler/common/allocation_stats.h>
 #include <shader_compiler/environment.h>
 #include <shader_compiler/frontend/ir/condition.h>
 #include <shader_compiler/frontend/ir/reg.h>
@@ -58,7 +59,7 @@ public:
     [[nodiscard]] Stack Remove(Token token) const;
 
 private:
-    std::vector<StackEntry> entries;
+    std::vector<StackEntry, Allocation::CountingAllocator<StackEntry>> entries;
 };
 
 struct IndirectBranch {
@@ -86,7 +87,7 @@ struct Block : boost::intrusive::set_base_hook<
     Block* return_block{};
     IR::Reg branch_reg{};
     s32 branch_offset{};
-    std::vector<IndirectBranch> indirect_branches;
+    std::vector<IndirectBranch, Allocation::CountingAllocator<IndirectBranch>> indirect_branches;
 };
 
 struct Label {
@@ -132,6 +133,16 @@ public:
         return exits_to_dispatcher;
     }
 
+    /// Hash of the reached instruction words and the block boundaries they are laid out in
+    /// Scheduling words and code that is never reached don't affect it, so padding around the
+    /// program doesn't change the result
+    [[nodiscard]] u64 CodeHash() const;
+
+    /// Heap allocations made while building the graph
+    [[nodiscard]] const AllocationStats& Allocations() const noexcept {
+        return allocation_stats;
+    }
+
 private:
     void AnalyzeLabel(FunctionId function_id, Label& label);
 
@@ -163,6 +174,12 @@ private:
     Location program_start;
     bool exits_to_dispatcher{};
     Block* dispatch_block{};
+    AllocationStats allocation_stats;
 };
 
+/// Returns true when the predicated instruction at pc is part of a short run of side effect free
+/// instructions, these are kept inline and translated with selects on their destinations instead of
+/// being placed in conditional blocks
+[[nodiscard]] bool IsPredicatedInline(Environment& env, Location pc);
+
 } // namespace Shader::Maxwell::Flow
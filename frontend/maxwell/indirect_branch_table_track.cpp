@@ -26,7 +26,14 @@ std::optional<u64> Track(Environment& env, Location block_begin, Location& pos,
     while (pos >= block_begin) {
         const u64 insn{env.ReadInstruction(pos.Offset())};
         --pos;
-        if (func(insn, Decode(insn))) {
+        Opcode opcode{};
+        try {
+            opcode = Decode(insn);
+        } catch (const NotImplementedException&) {
+            // Unknown encodings can't be the tracked instruction
+            continue;
+        }
+        if (func(insn, opcode)) {
             return insn;
         }
     }
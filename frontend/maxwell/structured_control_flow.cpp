@@ -4,13 +4,16 @@
 #include <range/v3/algorithm.hpp>
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 
+#include <boost/container/small_vector.hpp>
 #include <boost/intrusive/list.hpp>
 
 #include <shader_compiler/environment.h>
@@ -21,6 +24,7 @@
 #include <shader_compiler/host_translate_info.h>
 #include <shader_compiler/object_pool.h>
 #include <shader_compiler/common/log.h>
+#include <shader_compiler/common/trace.h>
 
 namespace Shader::Maxwell {
 namespace {
@@ -310,6 +314,164 @@ bool NeedsLift(Node goto_stmt, Node label_stmt) noexcept {
     return AreOrdered(sibling, goto_stmt);
 }
 
+/// Blocks reachable from the entry point of each function, so they can be dropped before they are
+/// translated. Code behind calls to functions that never return is unreachable as well.
+class Reachability {
+public:
+    explicit Reachability(Flow::CFG& cfg)
+        : functions{cfg.Functions()}, reachable(functions.size()), can_return(functions.size()) {}
+
+    [[nodiscard]] bool IsReachable(Flow::FunctionId function_id, const Flow::Block& block) {
+        return Visit(function_id).contains(&block);
+    }
+
+    [[nodiscard]] bool CanReturn(Flow::FunctionId function_id) {
+        Visit(function_id);
+        return can_return[function_id];
+    }
+
+private:
+    const std::unordered_set<const Flow::Block*>& Visit(Flow::FunctionId function_id) {
+        if (reachable[function_id]) {
+            return *reachable[function_id];
+        }
+        // Recursive calls see the partial result, assume they return until proven otherwise
+        can_return[function_id] = true;
+        std::unordered_set<const Flow::Block*>& visited{reachable[function_id].emplace()};
+        Flow::Function& function{functions[function_id]};
+        visited.reserve(function.blocks.size());
+
+        // Conditional instructions at the entry point are impersonated by a virtual block
+        const Location entrypoint{function.entrypoint.Virtual()};
+        const auto entry{ranges::find_if(function.blocks, [entrypoint](const Flow::Block& block) {
+            return block.begin >= entrypoint;
+        })};
+        if (entry == function.blocks.end()) {
+            return visited;
+        }
+        boost::container::small_vector<const Flow::Block*, 32> pending{&*entry};
+        visited.insert(&*entry);
+        const auto push{[&](const Flow::Block* target) {
+            if (target && visited.insert(target).second) {
+                pending.push_back(target);
+            }
+        }};
+        bool returns{false};
+        while (!pending.empty()) {
+            const Flow::Block* const block{pending.back()};
+            pending.pop_back();
+            switch (block->end_class) {
+            case Flow::EndClass::Branch:
+                if (block->cond != IR::Condition{false}) {
+                    push(block->branch_true);
+                }
+                if (block->cond != IR::Condition{true}) {
+                    push(block->branch_false);
+                }
+                break;
+            case Flow::EndClass::IndirectBranch:
+                for (const Flow::IndirectBranch& indirect : block->indirect_branches) {
+                    push(indirect.block);
+                }
+                break;
+            case Flow::EndClass::Call:
+                if (CanReturn(block->function_call)) {
+                    push(block->return_block);
+                }
+                break;
+            case Flow::EndClass::Exit:
+                break;
+            case Flow::EndClass::Return:
+                returns = true;
+                break;
+            case Flow::EndClass::Kill:
+                // Demotion continues execution on the next instruction
+                push(block->branch_true);
+                break;
+            }
+        }
+        can_return[function_id] = returns;
+        return visited;
+    }
+
+    std::span<Flow::Function> functions;
+    std::vector<std::optional<std::unordered_set<const Flow::Block*>>> reachable;
+    std::vector<bool> can_return;
+};
+
+/// Whether the condition codes may be read after each block, so flag writes that are never read
+/// can be skipped while translating. Callees and callers are assumed to read them.
+class FlagLiveness {
+public:
+    explicit FlagLiveness(Environment& env, Flow::CFG& cfg) {
+        for (Flow::Function& function : cfg.Functions()) {
+            for (const Flow::Block& block : function.blocks) {
+                const bool reads{ReadsConditionCodes(env, block.begin.Offset(), block.end.Offset())};
+                states.emplace(&block, State{.reads = reads, .live_out = false});
+            }
+        }
+        // Liveness only grows, iterate backwards until it settles
+        bool changed{true};
+        while (changed) {
+            changed = false;
+            for (Flow::Function& function : cfg.Functions()) {
+                const auto end{function.blocks.rend()};
+                for (auto it = function.blocks.rbegin(); it != end; ++it) {
+                    State& state{states.at(&*it)};
+                    if (!state.live_out && ComputeLiveOut(*it)) {
+                        state.live_out = true;
+                        changed = true;
+                    }
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] bool IsLiveOut(const Flow::Block& block) const {
+        const auto it{states.find(&block)};
+        return it == states.end() || it->second.live_out;
+    }
+
+private:
+    struct State {
+        bool reads;
+        bool live_out;
+    };
+
+    bool IsLiveIn(const Flow::Block* block) const {
+        if (!block) {
+            return false;
+        }
+        const State& state{states.at(block)};
+        return state.reads || state.live_out;
+    }
+
+    bool ComputeLiveOut(const Flow::Block& block) const {
+        if (block.cond.GetFlowTest() != IR::FlowTest::T) {
+            return true;
+        }
+        switch (block.end_class) {
+        case Flow::EndClass::Branch:
+            return IsLiveIn(block.branch_true) || IsLiveIn(block.branch_false);
+        case Flow::EndClass::IndirectBranch:
+            return ranges::any_of(block.indirect_branches,
+                                  [this](const Flow::IndirectBranch& indirect) {
+                                      return IsLiveIn(indirect.block);
+                                  });
+        case Flow::EndClass::Call:
+        case Flow::EndClass::Return:
+            return true;
+        case Flow::EndClass::Exit:
+            return false;
+        case Flow::EndClass::Kill:
+            return IsLiveIn(block.branch_true);
+        }
+        return true;
+    }
+
+    std::unordered_map<const Flow::Block*, State> states;
+};
+
 class GotoPass {
 public:
     explicit GotoPass(Flow::CFG& cfg, ObjectPool<Statement>& stmt_pool) : pool{stmt_pool} {
@@ -378,27 +540,35 @@ private:
     std::vector<Node> BuildTree(Flow::CFG& cfg) {
         u32 label_id{0};
         std::vector<Node> gotos;
-        Flow::Function& first_function{cfg.Functions().front()};
-        BuildTree(cfg, first_function, label_id, gotos, root_stmt.children.end(), std::nullopt);
+        Reachability reachability{cfg};
+        BuildTree(cfg, reachability, 0, label_id, gotos, root_stmt.children.end(), std::nullopt);
         return gotos;
     }
 
-    void BuildTree(Flow::CFG& cfg, Flow::Function& function, u32& label_id,
-                   std::vector<Node>& gotos, Node function_insert_point,
+    void BuildTree(Flow::CFG& cfg, Reachability& reachability, Flow::FunctionId function_id,
+                   u32& label_id, std::vector<Node>& gotos, Node function_insert_point,
                    std::optional<Node> return_label) {
         Statement* const false_stmt{pool.Create(Identity{}, IR::Condition{false}, &root_stmt)};
         Tree& root{root_stmt.children};
+        Flow::Function& function{cfg.Functions()[function_id]};
         std::unordered_map<Flow::Block*, Node> local_labels;
         local_labels.reserve(function.blocks.size());
 
         for (Flow::Block& block : function.blocks) {
+            if (!reachability.IsReachable(function_id, block)) {
+                continue;
+            }
             Statement* const label{pool.Create(Label{}, label_id, &root_stmt)};
             const Node label_it{root.insert(function_insert_point, *label)};
             local_labels.emplace(&block, label_it);
             ++label_id;
         }
         for (Flow::Block& block : function.blocks) {
-            const Node label{local_labels.at(&block)};
+            const auto label_it{local_labels.find(&block)};
+            if (label_it == local_labels.end()) {
+                continue;
+            }
+            const Node label{label_it->second};
             // Insertion point
             const Node ip{std::next(label)};
 
@@ -446,9 +616,12 @@ private:
                 root.insert(ip, *pool.Create(Unreachable{}, &root_stmt));
                 break;
             case Flow::EndClass::Call: {
-                Flow::Function& call{cfg.Functions()[block.function_call]};
-                const Node call_return_label{local_labels.at(block.return_block)};
-                BuildTree(cfg, call, label_id, gotos, ip, call_return_label);
+                std::optional<Node> call_return_label;
+                if (reachability.CanReturn(block.function_call)) {
+                    call_return_label = local_labels.at(block.return_block);
+                }
+                BuildTree(cfg, reachability, block.function_call, label_id, gotos, ip,
+                          call_return_label);
                 break;
             }
             case Flow::EndClass::Exit:
@@ -652,9 +825,11 @@ class TranslatePass {
 public:
     TranslatePass(ObjectPool<IR::Inst>& inst_pool_, ObjectPool<IR::Block>& block_pool_,
                   ObjectPool<Statement>& stmt_pool_, Environment& env_, Statement& root_stmt,
-                  IR::AbstractSyntaxList& syntax_list_, const HostTranslateInfo& host_info)
+                  IR::AbstractSyntaxList& syntax_list_, const FlagLiveness& flag_liveness_,
+                  const HostTranslateInfo& host_info, IR::Diagnostics& diagnostics_)
         : stmt_pool{stmt_pool_}, inst_pool{inst_pool_}, block_pool{block_pool_}, env{env_},
-          syntax_list{syntax_list_} {
+          syntax_list{syntax_list_}, flag_liveness{flag_liveness_},
+          diagnostics{host_info.stub_unimplemented ? &diagnostics_ : nullptr} {
         Visit(root_stmt, nullptr, nullptr);
 
         IR::Block& first_block{*syntax_list.front().data.block};
@@ -686,7 +861,8 @@ private:
                 break;
             case StatementType::Code: {
                 ensure_block();
-                Translate(env, current_block, stmt.block->begin.Offset(), stmt.block->end.Offset());
+                Translate(env, current_block, stmt.block->begin.Offset(), stmt.block->end.Offset(),
+                          flag_liveness.IsLiveOut(*stmt.block), diagnostics);
                 break;
             }
             case StatementType::SetVariable: {
@@ -976,6 +1152,8 @@ private:
     ObjectPool<IR::Block>& block_pool;
     Environment& env;
     IR::AbstractSyntaxList& syntax_list;
+    const FlagLiveness& flag_liveness;
+    IR::Diagnostics* diagnostics;
     bool uses_demote_to_helper{};
     const Flow::Block dummy_flow_block;
 };
@@ -983,12 +1161,26 @@ private:
 
 IR::AbstractSyntaxList BuildASL(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Block>& block_pool,
                                 Environment& env, Flow::CFG& cfg,
-                                const HostTranslateInfo& host_info) {
+                                const HostTranslateInfo& host_info, IR::Diagnostics& diagnostics) {
+    SHADER_TRACE_SCOPE("BuildASL");
     ObjectPool<Statement> stmt_pool{64};
-    GotoPass goto_pass{cfg, stmt_pool};
-    Statement& root{goto_pass.RootStatement()};
+    std::optional<GotoPass> goto_pass;
+    {
+        SHADER_TRACE_SCOPE("GotoPass");
+        goto_pass.emplace(cfg, stmt_pool);
+    }
+    Statement& root{goto_pass->RootStatement()};
+    std::optional<FlagLiveness> flag_liveness;
+    {
+        SHADER_TRACE_SCOPE("FlagLiveness");
+        flag_liveness.emplace(env, cfg);
+    }
     IR::AbstractSyntaxList syntax_list;
-    TranslatePass{inst_pool, block_pool, stmt_pool, env, root, syntax_list, host_info};
+    {
+        SHADER_TRACE_SCOPE("TranslatePass");
+        TranslatePass{inst_pool,   block_pool,     stmt_pool, env,        root,
+                      syntax_list, *flag_liveness, host_info, diagnostics};
+    }
     return syntax_list;
 }
 
@@ -6,6 +6,7 @@
 #include <shader_compiler/environment.h>
 #include <shader_compiler/frontend/ir/abstract_syntax_list.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
+#include <shader_compiler/frontend/ir/diagnostic.h>
 #include <shader_compiler/frontend/ir/value.h>
 #include <shader_compiler/frontend/maxwell/control_flow.h>
 #include <shader_compiler/object_pool.h>
@@ -16,7 +17,8 @@ namespace Maxwell {
 
 [[nodiscard]] IR::AbstractSyntaxList BuildASL(ObjectPool<IR::Inst>& inst_pool,
                                               ObjectPool<IR::Block>& block_pool, Environment& env,
-                                              Flow::CFG& cfg, const HostTranslateInfo& host_info);
+                                              Flow::CFG& cfg, const HostTranslateInfo& host_info,
+                                              IR::Diagnostics& diagnostics);
 
 } // namespace Maxwell
 } // namespace Shader
@@ -21,6 +21,9 @@ void RRO(TranslatorVisitor& v, u64 insn, const IR::F32& src) {
         BitField<49, 1, u64> abs;
     } const rro{insn};
 
+    // RRO only prepares the operand of the MUFU.SIN, MUFU.COS or MUFU.EX2 that follows it, the IR
+    // transcendentals take the unreduced argument so the pair becomes a single operation. Sign
+    // modifiers of both instructions are folded together by constant propagation.
     v.F(rro.dest_reg, v.ir.FPAbsNeg(src, rro.abs != 0, rro.neg != 0));
 }
 } // Anonymous namespace
@@ -33,8 +36,8 @@ void TranslatorVisitor::RRO_cbuf(u64 insn) {
     RRO(*this, insn, GetFloatCbuf(insn));
 }
 
-void TranslatorVisitor::RRO_imm(u64) {
-    throw NotImplementedException("RRO (imm)");
+void TranslatorVisitor::RRO_imm(u64 insn) {
+    RRO(*this, insn, GetFloatImm20(insn));
 }
 
 } // namespace Shader::Maxwell
@@ -13,6 +13,21 @@ void HADD2(TranslatorVisitor& v, u64 insn, Merge merge, bool ftz, bool sat, bool
         BitField<8, 8, IR::Reg> src_a;
     } const hadd2{insn};
 
+    const IR::FpControl fp_control{
+        .no_contraction = true,
+        .rounding = IR::FpRounding::DontCare,
+        .fmz_mode = (ftz ? IR::FmzMode::FTZ : IR::FmzMode::None),
+    };
+    if (IsPackable(merge, {swizzle_a, swizzle_b})) {
+        const IR::Value op_a{ExtractPacked(v.ir, v.X(hadd2.src_a), swizzle_a, abs_a, neg_a)};
+        const IR::Value op_b{ExtractPacked(v.ir, src_b, swizzle_b, abs_b, neg_b)};
+        IR::Value result{v.ir.FPAddPacked(op_a, op_b, fp_control)};
+        if (sat) {
+            result = v.ir.FPSaturatePacked(result);
+        }
+        v.X(hadd2.dest_reg, v.ir.PackFloat2x16(result));
+        return;
+    }
     auto [lhs_a, rhs_a]{Extract(v.ir, v.X(hadd2.src_a), swizzle_a)};
     auto [lhs_b, rhs_b]{Extract(v.ir, src_b, swizzle_b)};
     const bool promotion{lhs_a.Type() != lhs_b.Type()};
@@ -32,11 +47,6 @@ void HADD2(TranslatorVisitor& v, u64 insn, Merge merge, bool ftz, bool sat, bool
     lhs_b = v.ir.FPAbsNeg(lhs_b, abs_b, neg_b);
     rhs_b = v.ir.FPAbsNeg(rhs_b, abs_b, neg_b);
 
-    const IR::FpControl fp_control{
-        .no_contraction = true,
-        .rounding = IR::FpRounding::DontCare,
-        .fmz_mode = (ftz ? IR::FmzMode::FTZ : IR::FmzMode::None),
-    };
     IR::F16F32F64 lhs{v.ir.FPAdd(lhs_a, lhs_b, fp_control)};
     IR::F16F32F64 rhs{v.ir.FPAdd(rhs_a, rhs_b, fp_control)};
     if (sat) {
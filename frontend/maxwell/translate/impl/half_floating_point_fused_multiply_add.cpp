@@ -14,6 +14,24 @@ void HFMA2(TranslatorVisitor& v, u64 insn, Merge merge, Swizzle swizzle_a, bool
         BitField<8, 8, IR::Reg> src_a;
     } const hfma2{insn};
 
+    const IR::FpControl fp_control{
+        .no_contraction = true,
+        .rounding = IR::FpRounding::DontCare,
+        .fmz_mode = HalfPrecision2FmzMode(precision),
+    };
+    // FMZ without saturation needs per-lane zero tests, those stay scalar
+    const bool fmz_select{precision == HalfPrecision::FMZ && !sat};
+    if (!fmz_select && IsPackable(merge, {swizzle_a, swizzle_b, swizzle_c})) {
+        const IR::Value op_a{ExtractPacked(v.ir, v.X(hfma2.src_a), swizzle_a, false, false)};
+        const IR::Value op_b{ExtractPacked(v.ir, src_b, swizzle_b, false, neg_b)};
+        const IR::Value op_c{ExtractPacked(v.ir, src_c, swizzle_c, false, neg_c)};
+        IR::Value result{v.ir.FPFmaPacked(op_a, op_b, op_c, fp_control)};
+        if (sat) {
+            result = v.ir.FPSaturatePacked(result);
+        }
+        v.X(hfma2.dest_reg, v.ir.PackFloat2x16(result));
+        return;
+    }
     auto [lhs_a, rhs_a]{Extract(v.ir, v.X(hfma2.src_a), swizzle_a)};
     auto [lhs_b, rhs_b]{Extract(v.ir, src_b, swizzle_b)};
     auto [lhs_c, rhs_c]{Extract(v.ir, src_c, swizzle_c)};
@@ -39,14 +57,9 @@ void HFMA2(TranslatorVisitor& v, u64 insn, Merge merge, Swizzle swizzle_a, bool
     lhs_c = v.ir.FPAbsNeg(lhs_c, false, neg_c);
     rhs_c = v.ir.FPAbsNeg(rhs_c, false, neg_c);
 
-    const IR::FpControl fp_control{
-        .no_contraction = true,
-        .rounding = IR::FpRounding::DontCare,
-        .fmz_mode = HalfPrecision2FmzMode(precision),
-    };
     IR::F16F32F64 lhs{v.ir.FPFma(lhs_a, lhs_b, lhs_c, fp_control)};
     IR::F16F32F64 rhs{v.ir.FPFma(rhs_a, rhs_b, rhs_c, fp_control)};
-    if (precision == HalfPrecision::FMZ && !sat) {
+    if (fmz_select) {
         // Do not implement FMZ if SAT is enabled, as it does the logic for us.
         // On D3D9 mode, anything * 0 is zero, even NAN and infinity
         const IR::F32 zero{v.ir.Imm32(0.0f)};
@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include <shader_compiler/frontend/maxwell/translate/impl/half_floating_point_helper.h>
 
 namespace Shader::Maxwell {
@@ -40,6 +42,37 @@ std::pair<IR::F16F32F64, IR::F16F32F64> Extract(IR::IREmitter& ir, IR::U32 value
     throw InvalidArgument("Invalid swizzle {}", swizzle);
 }
 
+bool IsPackable(Merge merge, std::initializer_list<Swizzle> swizzles) {
+    if (merge != Merge::H1_H0) {
+        return false;
+    }
+    return std::ranges::none_of(swizzles, [](Swizzle swizzle) { return swizzle == Swizzle::F32; });
+}
+
+IR::Value ExtractPacked(IR::IREmitter& ir, IR::U32 value, Swizzle swizzle, bool abs, bool neg) {
+    if (abs) {
+        value = ir.BitwiseAnd(value, ir.Imm32(0x7fff7fff));
+    }
+    if (neg) {
+        value = ir.BitwiseXor(value, ir.Imm32(0x80008000));
+    }
+    switch (swizzle) {
+    case Swizzle::H1_H0:
+        break;
+    case Swizzle::H0_H0:
+        value = ir.BitFieldInsert(value, value, ir.Imm32(16), ir.Imm32(16));
+        break;
+    case Swizzle::H1_H1: {
+        const IR::U32 high{ir.ShiftRightLogical(value, ir.Imm32(16))};
+        value = ir.BitFieldInsert(high, high, ir.Imm32(16), ir.Imm32(16));
+        break;
+    }
+    default:
+        throw InvalidArgument("Invalid packed swizzle {}", swizzle);
+    }
+    return ir.UnpackFloat2x16(value);
+}
+
 IR::U32 MergeResult(IR::IREmitter& ir, IR::Reg dest, const IR::F16& lhs, const IR::F16& rhs,
                     Merge merge) {
     switch (merge) {
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <initializer_list>
+
 #include <shader_compiler/common/common_types.h>
 #include <shader_compiler/exception.h>
 #include <shader_compiler/frontend/maxwell/translate/impl/impl.h>
@@ -33,6 +35,14 @@ IR::FmzMode HalfPrecision2FmzMode(HalfPrecision precision);
 
 std::pair<IR::F16F32F64, IR::F16F32F64> Extract(IR::IREmitter& ir, IR::U32 value, Swizzle swizzle);
 
+/// Returns true when both lanes can be computed as one packed F16x2 operation, that is when no
+/// operand is promoted to F32 and the result is written as two halves
+bool IsPackable(Merge merge, std::initializer_list<Swizzle> swizzles);
+
+/// Returns the F16x2 vector of a packed operand, the swizzle and modifiers are applied to the
+/// packed bits before unpacking
+IR::Value ExtractPacked(IR::IREmitter& ir, IR::U32 value, Swizzle swizzle, bool abs, bool neg);
+
 IR::U32 MergeResult(IR::IREmitter& ir, IR::Reg dest, const IR::F16& lhs, const IR::F16& rhs,
                     Merge merge);
 
@@ -14,6 +14,23 @@ void HMUL2(TranslatorVisitor& v, u64 insn, Merge merge, bool sat, bool abs_a, bo
         BitField<8, 8, IR::Reg> src_a;
     } const hmul2{insn};
 
+    const IR::FpControl fp_control{
+        .no_contraction = true,
+        .rounding = IR::FpRounding::DontCare,
+        .fmz_mode = HalfPrecision2FmzMode(precision),
+    };
+    // FMZ without saturation needs per-lane zero tests, those stay scalar
+    const bool fmz_select{precision == HalfPrecision::FMZ && !sat};
+    if (!fmz_select && IsPackable(merge, {swizzle_a, swizzle_b})) {
+        const IR::Value op_a{ExtractPacked(v.ir, v.X(hmul2.src_a), swizzle_a, abs_a, neg_a)};
+        const IR::Value op_b{ExtractPacked(v.ir, src_b, swizzle_b, abs_b, neg_b)};
+        IR::Value result{v.ir.FPMulPacked(op_a, op_b, fp_control)};
+        if (sat) {
+            result = v.ir.FPSaturatePacked(result);
+        }
+        v.X(hmul2.dest_reg, v.ir.PackFloat2x16(result));
+        return;
+    }
     auto [lhs_a, rhs_a]{Extract(v.ir, v.X(hmul2.src_a), swizzle_a)};
     auto [lhs_b, rhs_b]{Extract(v.ir, src_b, swizzle_b)};
     const bool promotion{lhs_a.Type() != lhs_b.Type()};
@@ -33,14 +50,9 @@ void HMUL2(TranslatorVisitor& v, u64 insn, Merge merge, bool sat, bool abs_a, bo
     lhs_b = v.ir.FPAbsNeg(lhs_b, abs_b, neg_b);
     rhs_b = v.ir.FPAbsNeg(rhs_b, abs_b, neg_b);
 
-    const IR::FpControl fp_control{
-        .no_contraction = true,
-        .rounding = IR::FpRounding::DontCare,
-        .fmz_mode = HalfPrecision2FmzMode(precision),
-    };
     IR::F16F32F64 lhs{v.ir.FPMul(lhs_a, lhs_b, fp_control)};
     IR::F16F32F64 rhs{v.ir.FPMul(rhs_a, rhs_b, fp_control)};
-    if (precision == HalfPrecision::FMZ && !sat) {
+    if (fmz_select) {
         // Do not implement FMZ if SAT is enabled, as it does the logic for us.
         // On D3D9 mode, anything * 0 is zero, even NAN and infinity
         const IR::F32 zero{v.ir.Imm32(0.0f)};
@@ -237,18 +237,30 @@ IR::F32 TranslatorVisitor::GetFloatImm32(u64 insn) {
 }
 
 void TranslatorVisitor::SetZFlag(const IR::U1& value) {
+    if (!flags_live) {
+        return;
+    }
     ir.SetZFlag(value);
 }
 
 void TranslatorVisitor::SetSFlag(const IR::U1& value) {
+    if (!flags_live) {
+        return;
+    }
     ir.SetSFlag(value);
 }
 
 void TranslatorVisitor::SetCFlag(const IR::U1& value) {
+    if (!flags_live) {
+        return;
+    }
     ir.SetCFlag(value);
 }
 
 void TranslatorVisitor::SetOFlag(const IR::U1& value) {
+    if (!flags_live) {
+        return;
+    }
     ir.SetOFlag(value);
 }
 
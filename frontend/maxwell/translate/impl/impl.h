@@ -60,6 +60,10 @@ public:
     Environment& env;
     IR::IREmitter ir;
 
+    /// False when the condition codes written by the current instruction are never read, .CC
+    /// modes skip computing them in that case
+    bool flags_live{true};
+
     void AL2P(u64 insn);
     void ALD(u64 insn);
     void AST(u64 insn);
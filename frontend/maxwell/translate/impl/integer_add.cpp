@@ -36,7 +36,7 @@ void IADD(TranslatorVisitor& v, u64 insn, const IR::U32 op_b, bool neg_a, bool p
         // .PO adds one to the result
         result = v.ir.IAdd(result, v.ir.Imm32(1));
     }
-    if (cc) {
+    if (cc && v.flags_live) {
         // Store flags
         // TODO: Does this grab the result pre-PO or after?
         if (po) {
@@ -81,7 +81,7 @@ void IADD3(TranslatorVisitor& v, u64 insn, IR::U32 op_a, IR::U32 op_b, IR::U32 o
     const IR::U32 result{v.ir.IAdd(lhs_2, op_c)};
 
     v.X(iadd3.dest_reg, result);
-    if (iadd3.cc != 0) {
+    if (iadd3.cc != 0 && v.flags_live) {
         // TODO: How does CC behave when X is set?
         if (iadd3.x != 0) {
             throw NotImplementedException("IADD3 X+CC");
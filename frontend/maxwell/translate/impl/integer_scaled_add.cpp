@@ -36,7 +36,7 @@ void ISCADD(TranslatorVisitor& v, u64 insn, IR::U32 op_b, bool cc, bool neg_a, b
     const IR::U32 result{v.ir.IAdd(scaled_a, op_b)};
     v.X(iscadd.dest_reg, result);
 
-    if (cc) {
+    if (cc && v.flags_live) {
         v.SetZFlag(v.ir.GetZeroFromOp(result));
         v.SetSFlag(v.ir.GetSignFromOp(result));
         const IR::U1 carry{v.ir.GetCarryFromOp(result)};
@@ -101,7 +101,7 @@ void I2I(TranslatorVisitor& v, u64 insn, const IR::U32& src_a) {
             : ConvertInteger(v.ir, src_values, i2i.dst_fmt)};
 
     v.X(i2i.dest_reg, result);
-    if (i2i.cc != 0) {
+    if (i2i.cc != 0 && v.flags_live) {
         v.SetZFlag(v.ir.GetZeroFromOp(result));
         v.SetSFlag(v.ir.GetSignFromOp(result));
         v.ResetCFlag();
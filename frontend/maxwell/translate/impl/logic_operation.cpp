@@ -56,7 +56,7 @@ void LOP(TranslatorVisitor& v, u64 insn, IR::U32 op_b, bool x, bool cc, bool inv
         const IR::U1 pred_result{PredicateOperation(v.ir, result, *pred_op)};
         v.ir.SetPred(dest_pred, pred_result);
     }
-    if (cc) {
+    if (cc && v.flags_live) {
         if (bit_op == LogicalOp::PASS_B) {
             v.SetZFlag(v.ir.IEqual(result, v.ir.Imm32(0)));
             v.SetSFlag(v.ir.ILessThan(result, v.ir.Imm32(0), true));
@@ -1,9 +1,15 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <iterator>
+#include <optional>
+
 #include <shader_compiler/environment.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
+#include <shader_compiler/frontend/ir/ir_emitter.h>
+#include <shader_compiler/frontend/maxwell/control_flow.h>
 #include <shader_compiler/frontend/maxwell/decode.h>
+#include <shader_compiler/frontend/maxwell/instruction.h>
 #include <shader_compiler/frontend/maxwell/location.h>
 #include <shader_compiler/frontend/maxwell/translate/impl/impl.h>
 #include <shader_compiler/frontend/maxwell/translate/translate.h>
@@ -22,13 +28,153 @@ static void Invoke(TranslatorVisitor& visitor, Location pc, u64 insn) {
     }
 }
 
-void Translate(Environment& env, IR::Block* block, u32 location_begin, u32 location_end) {
+/// Removes the instructions emitted by a partially translated guest instruction
+static void DiscardInstsAfter(IR::Block& block, size_t num_insts) {
+    IR::Block::InstructionList& insts{block.Instructions()};
+    while (insts.size() > num_insts) {
+        const auto it{std::prev(insts.end())};
+        it->Invalidate();
+        insts.erase(it);
+    }
+}
+
+/// Makes the register, predicate and flag writes of an inline predicated instruction conditional,
+/// the instruction itself is side effect free so its other operations can execute unconditionally
+static void SelectWrites(IR::Block& block, IR::Block::iterator first_inst,
+                         const IR::U1& condition) {
+    for (auto it = first_inst; it != block.end(); ++it) {
+        IR::Inst& inst{*it};
+        IR::IREmitter ir{block, it};
+        switch (inst.GetOpcode()) {
+        case IR::Opcode::SetRegister: {
+            const IR::U32 old_value{ir.GetReg(inst.Arg(0).Reg())};
+            inst.SetArg(1, ir.Select(condition, inst.Arg(1), old_value));
+            break;
+        }
+        case IR::Opcode::SetPred: {
+            const IR::U1 old_value{ir.GetPred(inst.Arg(0).Pred())};
+            inst.SetArg(1, ir.Select(condition, inst.Arg(1), old_value));
+            break;
+        }
+        case IR::Opcode::SetZFlag:
+            inst.SetArg(0, ir.Select(condition, inst.Arg(0), ir.GetZFlag()));
+            break;
+        case IR::Opcode::SetSFlag:
+            inst.SetArg(0, ir.Select(condition, inst.Arg(0), ir.GetSFlag()));
+            break;
+        case IR::Opcode::SetCFlag:
+            inst.SetArg(0, ir.Select(condition, inst.Arg(0), ir.GetCFlag()));
+            break;
+        case IR::Opcode::SetOFlag:
+            inst.SetArg(0, ir.Select(condition, inst.Arg(0), ir.GetOFlag()));
+            break;
+        default:
+            if (inst.MayHaveSideEffects()) {
+                throw LogicError("Predicated instruction emitted {}", inst.GetOpcode());
+            }
+            break;
+        }
+    }
+}
+
+static void StubInstruction(IR::Block& block, size_t num_insts, Location pc, u64 insn,
+                            const NotImplementedException& exception,
+                            IR::Diagnostics& diagnostics) {
+    DiscardInstsAfter(block, num_insts);
+    std::string opcode{"UNKNOWN"};
+    try {
+        opcode = NameOf(Decode(insn));
+    } catch (const NotImplementedException&) {
+        // Unknown encodings are reported without a name
+    }
+    diagnostics.push_back(IR::Diagnostic{
+        .kind = IR::Diagnostic::Kind::UnimplementedInstruction,
+        .pc = pc.Offset(),
+        .instruction = insn,
+        .opcode = std::move(opcode),
+        .message = exception.what(),
+    });
+}
+
+static bool ReadsConditionCodes(u64 insn) {
+    Opcode opcode{};
+    try {
+        opcode = Decode(insn);
+    } catch (const NotImplementedException&) {
+        return true;
+    }
+    switch (opcode) {
+    case Opcode::CSET:
+    case Opcode::CSETP:
+    case Opcode::IADD_reg:
+    case Opcode::IADD_cbuf:
+    case Opcode::IADD_imm:
+    case Opcode::IADD3_reg:
+    case Opcode::IADD3_cbuf:
+    case Opcode::IADD3_imm:
+    case Opcode::IADD32I:
+    case Opcode::ISET_reg:
+    case Opcode::ISET_cbuf:
+    case Opcode::ISET_imm:
+    case Opcode::ISETP_reg:
+    case Opcode::ISETP_cbuf:
+    case Opcode::ISETP_imm:
+    case Opcode::P2R_reg:
+    case Opcode::P2R_cbuf:
+    case Opcode::P2R_imm:
+    case Opcode::R2P_reg:
+    case Opcode::R2P_cbuf:
+    case Opcode::R2P_imm:
+        // The extended (.X) and CC modes of these read the flags, the encoding is not inspected
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool ReadsConditionCodes(Environment& env, u32 location_begin, u32 location_end) {
+    for (Location pc = location_begin; pc != location_end; ++pc) {
+        if (ReadsConditionCodes(env.ReadInstruction(pc.Offset()))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Translate(Environment& env, IR::Block* block, u32 location_begin, u32 location_end,
+               bool flags_live_out, IR::Diagnostics* diagnostics) {
     if (location_begin == location_end) {
         return;
     }
+    // Find the last instruction reading the condition codes, writes after it are dead so their
+    // flag computations and associated pseudo-instructions are never created
+    std::optional<Location> last_flags_read;
+    if (!flags_live_out) {
+        for (Location pc = location_end; pc != location_begin;) {
+            --pc;
+            if (ReadsConditionCodes(env.ReadInstruction(pc.Offset()))) {
+                last_flags_read = pc;
+                break;
+            }
+        }
+    }
+    bool flags_read_pending{last_flags_read.has_value()};
+
     TranslatorVisitor visitor{env, *block};
     for (Location pc = location_begin; pc != location_end; ++pc) {
         const u64 insn{env.ReadInstruction(pc.Offset())};
+        const size_t num_insts{block->Instructions().size()};
+        if (flags_read_pending && pc == *last_flags_read) {
+            flags_read_pending = false;
+        }
+        visitor.flags_live = flags_live_out || flags_read_pending;
+
+        // The predicate is read before the instruction executes, it may overwrite it
+        std::optional<IR::U1> condition;
+        if (Flow::IsPredicatedInline(env, pc)) {
+            const Predicate pred{Instruction{insn}.Pred()};
+            condition = visitor.ir.GetPred(static_cast<IR::Pred>(pred.index), pred.negated);
+        }
         try {
             const Opcode opcode{Decode(insn)};
             switch (opcode) {
@@ -41,6 +187,20 @@ void Translate(Environment& env, IR::Block* block, u32 location_begin, u32 locat
             default:
                 throw LogicError("Invalid opcode {}", opcode);
             }
+            if (condition) {
+                IR::Inst* const condition_inst{condition->InstRecursive()};
+                const auto first_inst{
+                    std::next(IR::Block::InstructionList::s_iterator_to(*condition_inst))};
+                SelectWrites(*block, first_inst, *condition);
+            }
+        } catch (NotImplementedException& exception) {
+            if (diagnostics) {
+                // The instruction becomes a no-op, its destinations keep their previous values
+                StubInstruction(*block, num_insts, pc, insn, exception, *diagnostics);
+                continue;
+            }
+            exception.Prepend(fmt::format("Translate {}: ", Decode(insn)));
+            throw;
         } catch (Exception& exception) {
             exception.Prepend(fmt::format("Translate {}: ", Decode(insn)));
             throw;
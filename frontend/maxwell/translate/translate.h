@@ -5,9 +5,19 @@
 
 #include <shader_compiler/environment.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
+#include <shader_compiler/frontend/ir/diagnostic.h>
 
 namespace Shader::Maxwell {
 
-void Translate(Environment& env, IR::Block* block, u32 location_begin, u32 location_end);
+/// Returns true when a guest instruction in [location_begin, location_end) may read the condition
+/// codes, unknown encodings are assumed to read them
+[[nodiscard]] bool ReadsConditionCodes(Environment& env, u32 location_begin, u32 location_end);
+
+/// Translates the guest instructions in [location_begin, location_end) into the given block
+/// When flags_live_out is false, condition codes written after the last instruction reading them
+/// are not emitted, this is only valid when no successor reads them
+/// When diagnostics is not null, unimplemented instructions are stubbed out and recorded in it
+void Translate(Environment& env, IR::Block* block, u32 location_begin, u32 location_end,
+               bool flags_live_out = true, IR::Diagnostics* diagnostics = nullptr);
 
 } // namespace Shader::Maxwell
@@ -3,11 +3,15 @@
 
 #include <range/v3/algorithm.hpp>
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <vector>
 #include <queue>
 
+#include <shader_compiler/common/allocation_stats.h>
+#include <shader_compiler/common/hash.h>
 #include <shader_compiler/common/settings.h>
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/exception.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
 #include <shader_compiler/frontend/ir/ir_emitter.h>
@@ -138,19 +142,19 @@ bool IsLegacyAttribute(IR::Attribute attribute) {
             attribute <= IR::Attribute::FixedFncTexture9Q);
 }
 
-std::map<IR::Attribute, IR::Attribute> GenerateLegacyToGenericMappings(
+IR::AttributeMapping GenerateLegacyToGenericMappings(
     const VaryingState& state, std::queue<IR::Attribute> unused_generics,
-    const std::map<IR::Attribute, IR::Attribute>& previous_stage_mapping) {
-    std::map<IR::Attribute, IR::Attribute> mapping;
+    const IR::AttributeMapping& previous_stage_mapping) {
+    IR::AttributeMapping mapping;
     auto update_mapping = [&mapping, &unused_generics, previous_stage_mapping](IR::Attribute attr,
                                                                                size_t count) {
         if (previous_stage_mapping.find(attr) != previous_stage_mapping.end()) {
             for (size_t i = 0; i < count; ++i) {
-                mapping.insert({attr + i, previous_stage_mapping.at(attr + i)});
+                mapping.emplace(attr + i, previous_stage_mapping.at(attr + i));
             }
         } else {
             for (size_t i = 0; i < count; ++i) {
-                mapping.insert({attr + i, unused_generics.front() + i});
+                mapping.emplace(attr + i, unused_generics.front() + i);
             }
             unused_generics.pop();
         }
@@ -178,17 +182,15 @@ void EmitGeometryPassthrough(IR::IREmitter& ir, const IR::Program& program,
                              bool passthrough_position,
                              std::optional<IR::Attribute> passthrough_layer_attr) {
     for (u32 i = 0; i < program.output_vertices; i++) {
-        // Assign generics from input
+        // Assign generics from input, components that were never stored are left undefined
         for (u32 j = 0; j < 32; j++) {
-            if (!passthrough_mask.Generic(j)) {
-                continue;
+            for (u32 component = 0; component < 4; component++) {
+                if (!passthrough_mask.Generic(j, component)) {
+                    continue;
+                }
+                const IR::Attribute attr = IR::Attribute::Generic0X + (j * 4 + component);
+                ir.SetAttribute(attr, ir.GetAttribute(attr, ir.Imm32(i)), ir.Imm32(0));
             }
-
-            const IR::Attribute attr = IR::Attribute::Generic0X + (j * 4);
-            ir.SetAttribute(attr + 0, ir.GetAttribute(attr + 0, ir.Imm32(i)), ir.Imm32(0));
-            ir.SetAttribute(attr + 1, ir.GetAttribute(attr + 1, ir.Imm32(i)), ir.Imm32(0));
-            ir.SetAttribute(attr + 2, ir.GetAttribute(attr + 2, ir.Imm32(i)), ir.Imm32(0));
-            ir.SetAttribute(attr + 3, ir.GetAttribute(attr + 3, ir.Imm32(i)), ir.Imm32(0));
         }
 
         if (passthrough_position) {
@@ -240,8 +242,12 @@ void LowerGeometryPassthrough(const IR::Program& program, const HostTranslateInf
 
 IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Block>& block_pool,
                              Environment& env, Flow::CFG& cfg, const HostTranslateInfo& host_info) {
+    SHADER_TRACE_SCOPE("TranslateProgram");
     IR::Program program;
-    program.syntax_list = BuildASL(inst_pool, block_pool, env, cfg, host_info);
+    program.allocation_stats = cfg.Allocations();
+    Allocation::Scope allocation_scope{program.allocation_stats, CompilePhase::Translation};
+    program.code_hash = cfg.CodeHash();
+    program.syntax_list = BuildASL(inst_pool, block_pool, env, cfg, host_info, program.diagnostics);
     program.blocks = GenerateBlocks(program.syntax_list);
     program.post_order_blocks = PostOrder(program.syntax_list.front());
     program.stage = env.ShaderStage();
@@ -280,6 +286,8 @@ IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Blo
     }
     RemoveUnreachableBlocks(program);
 
+    allocation_scope.SetPhase(CompilePhase::Optimization);
+
     // Replace instructions before the SSA rewrite
     if (!host_info.support_float16) {
         Optimization::LowerFp16ToFp32(program);
@@ -291,6 +299,11 @@ IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Blo
 
     Optimization::ConstantPropagationPass(env, program);
 
+    // FP64 values have to flow between instructions for pairs to skip the native conversions
+    if (host_info.lower_fp64_to_fp32_pair) {
+        Optimization::LowerFp64ToFp32Pair(program);
+    }
+
     Optimization::PositionPass(env, program);
 
     Optimization::GlobalMemoryToStorageBufferPass(program, host_info);
@@ -299,6 +312,9 @@ IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Blo
     if (Settings::values.resolution_info.active) {
         Optimization::RescalingPass(program);
     }
+    if (host_info.aggregate_shared_atomics && program.stage == Stage::Compute) {
+        Optimization::SharedAtomicAggregationPass(program);
+    }
     Optimization::DeadCodeEliminationPass(program);
     if (Settings::values.renderer_debug) {
         Optimization::VerificationPass(program);
@@ -313,7 +329,11 @@ IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Blo
 
 IR::Program MergeDualVertexPrograms(IR::Program& vertex_a, IR::Program& vertex_b,
                                     Environment& env_vertex_b) {
+    SHADER_TRACE_SCOPE("MergeDualVertexPrograms");
     IR::Program result{};
+    result.allocation_stats = vertex_a.allocation_stats;
+    result.allocation_stats += vertex_b.allocation_stats;
+    Allocation::Scope allocation_scope{result.allocation_stats, CompilePhase::Optimization};
     Optimization::VertexATransformPass(vertex_a);
     Optimization::VertexBTransformPass(vertex_b);
     for (const auto& term : vertex_a.syntax_list) {
@@ -329,10 +349,20 @@ IR::Program MergeDualVertexPrograms(IR::Program& vertex_a, IR::Program& vertex_b
         result.post_order_blocks.push_back(block);
     }
     result.stage = Stage::VertexB;
+    result.code_hash = HashWords(std::array{vertex_a.code_hash, vertex_b.code_hash});
     result.info = vertex_a.info;
     result.local_memory_size = std::max(vertex_a.local_memory_size, vertex_b.local_memory_size);
     result.info.loads.mask |= vertex_b.info.loads.mask;
     result.info.stores.mask |= vertex_b.info.stores.mask;
+    for (const CbufAssumption& assumption : vertex_b.info.cbuf_assumptions) {
+        const auto it{ranges::lower_bound(result.info.cbuf_assumptions, assumption)};
+        if (it == result.info.cbuf_assumptions.end() || *it != assumption) {
+            result.info.cbuf_assumptions.insert(it, assumption);
+        }
+    }
+    result.diagnostics = vertex_a.diagnostics;
+    result.diagnostics.insert(result.diagnostics.end(), vertex_b.diagnostics.begin(),
+                              vertex_b.diagnostics.end());
 
     Optimization::JoinTextureInfo(result.info, vertex_b.info);
     Optimization::JoinStorageInfo(result.info, vertex_b.info);
@@ -345,6 +375,7 @@ IR::Program MergeDualVertexPrograms(IR::Program& vertex_a, IR::Program& vertex_b
 }
 
 void ConvertLegacyToGeneric(IR::Program& program, const Shader::RuntimeInfo& runtime_info) {
+    SHADER_TRACE_SCOPE("ConvertLegacyToGeneric");
     auto& stores = program.info.stores;
     if (stores.Legacy()) {
         std::queue<IR::Attribute> unused_output_generics{};
@@ -404,22 +435,41 @@ void ConvertLegacyToGeneric(IR::Program& program, const Shader::RuntimeInfo& run
     }
 }
 
+GeometryPassthroughKey MakeGeometryPassthroughKey(const IR::Program& source_program,
+                                                  Shader::OutputTopology output_topology) {
+    return GeometryPassthroughKey{
+        .stores = source_program.info.stores,
+        .output_topology = output_topology,
+        .emulated_layer = source_program.info.emulated_layer,
+    };
+}
+
 IR::Program GenerateGeometryPassthrough(ObjectPool<IR::Inst>& inst_pool,
                                         ObjectPool<IR::Block>& block_pool,
                                         const HostTranslateInfo& host_info,
                                         IR::Program& source_program,
                                         Shader::OutputTopology output_topology) {
+    return GenerateGeometryPassthrough(inst_pool, block_pool, host_info,
+                                       MakeGeometryPassthroughKey(source_program, output_topology));
+}
+
+IR::Program GenerateGeometryPassthrough(ObjectPool<IR::Inst>& inst_pool,
+                                        ObjectPool<IR::Block>& block_pool,
+                                        const HostTranslateInfo& host_info,
+                                        const GeometryPassthroughKey& key) {
+    SHADER_TRACE_SCOPE("GenerateGeometryPassthrough");
     IR::Program program;
+    Allocation::Scope allocation_scope{program.allocation_stats, CompilePhase::Translation};
     program.stage = Stage::Geometry;
-    program.output_topology = output_topology;
-    program.output_vertices = GetOutputTopologyVertices(output_topology);
+    program.output_topology = key.output_topology;
+    program.output_vertices = GetOutputTopologyVertices(key.output_topology);
     program.invocations = 1;
 
     program.is_geometry_passthrough = false;
-    program.info.loads.mask = source_program.info.stores.mask;
-    program.info.stores.mask = source_program.info.stores.mask;
+    program.info.loads.mask = key.stores.mask;
+    program.info.stores.mask = key.stores.mask;
     program.info.stores.Set(IR::Attribute::Layer, true);
-    program.info.stores.Set(source_program.info.emulated_layer, false);
+    program.info.stores.Set(key.emulated_layer, false);
 
     IR::Block* current_block = block_pool.Create(inst_pool);
     auto& node{program.syntax_list.emplace_back()};
@@ -427,8 +477,7 @@ IR::Program GenerateGeometryPassthrough(ObjectPool<IR::Inst>& inst_pool,
     node.data.block = current_block;
 
     IR::IREmitter ir{*current_block};
-    EmitGeometryPassthrough(ir, program, program.info.stores, true,
-                            source_program.info.emulated_layer);
+    EmitGeometryPassthrough(ir, program, program.info.stores, true, key.emulated_layer);
 
     IR::Block* return_block{block_pool.Create(inst_pool)};
     IR::IREmitter{*return_block}.Epilogue();
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include <shader_compiler/environment.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
 #include <shader_compiler/frontend/ir/program.h>
@@ -25,9 +27,37 @@ namespace Shader::Maxwell {
 
 void ConvertLegacyToGeneric(IR::Program& program, const RuntimeInfo& runtime_info);
 
+/// Everything a generated passthrough geometry program depends on
+/// Programs generated from equal keys are identical, so their backend output can be shared
+struct GeometryPassthroughKey {
+    VaryingState stores;
+    OutputTopology output_topology{};
+    IR::Attribute emulated_layer{};
+
+    [[nodiscard]] bool operator==(const GeometryPassthroughKey& rhs) const noexcept {
+        return stores.mask == rhs.stores.mask && output_topology == rhs.output_topology &&
+               emulated_layer == rhs.emulated_layer;
+    }
+
+    [[nodiscard]] size_t Hash() const noexcept {
+        size_t hash{std::hash<std::bitset<512>>{}(stores.mask)};
+        hash ^= static_cast<size_t>(output_topology) * 0x9e3779b97f4a7c15ULL;
+        hash ^= static_cast<size_t>(emulated_layer) << 8;
+        return hash;
+    }
+};
+
+[[nodiscard]] GeometryPassthroughKey MakeGeometryPassthroughKey(
+    const IR::Program& source_program, Shader::OutputTopology output_topology);
+
 // Maxwell v1 and older Nvidia cards don't support setting gl_Layer from non-geometry stages.
 // This creates a workaround by setting the layer as a generic output and creating a
 // passthrough geometry shader that reads the generic and sets the layer.
+[[nodiscard]] IR::Program GenerateGeometryPassthrough(ObjectPool<IR::Inst>& inst_pool,
+                                                      ObjectPool<IR::Block>& block_pool,
+                                                      const HostTranslateInfo& host_info,
+                                                      const GeometryPassthroughKey& key);
+
 [[nodiscard]] IR::Program GenerateGeometryPassthrough(ObjectPool<IR::Inst>& inst_pool,
                                                       ObjectPool<IR::Block>& block_pool,
                                                       const HostTranslateInfo& host_info,
@@ -35,3 +65,10 @@ void ConvertLegacyToGeneric(IR::Program& program, const RuntimeInfo& runtime_inf
                                                       Shader::OutputTopology output_topology);
 
 } // namespace Shader::Maxwell
+
+template <>
+struct std::hash<Shader::Maxwell::GeometryPassthroughKey> {
+    size_t operator()(const Shader::Maxwell::GeometryPassthroughKey& key) const noexcept {
+        return key.Hash();
+    }
+};
@@ -18,6 +18,12 @@ struct HostTranslateInfo {
     u32 min_ssbo_alignment{};            ///< Minimum alignment supported by the device for SSBOs
     bool support_geometry_shader_passthrough{}; ///< True when the device supports geometry
                                                 ///< passthrough shaders
+    bool stub_unimplemented{}; ///< True to stub unimplemented instructions and untrackable
+                               ///< bindless handles instead of failing, see IR::Program::diagnostics
+    bool lower_fp64_to_fp32_pair{}; ///< True to emulate 64-bit float arithmetic with pairs of
+                                    ///< 32-bit floats on devices with slow FP64, at reduced precision
+    bool aggregate_shared_atomics{}; ///< True to combine same-address shared memory atomics per
+                                     ///< subgroup, requires subgroup arithmetic in compute shaders
 };
 
 } // namespace Shader
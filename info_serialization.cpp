@@ -0,0 +1,480 @@
+// SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <bit>
+#include <bitset>
+#include <optional>
+#include <type_traits>
+
+#include <shader_compiler/exception.h>
+#include <shader_compiler/info_serialization.h>
+
+namespace Shader {
+namespace {
+/// Writes values as little-endian bytes, flags are packed eight to a byte
+class Writer {
+public:
+    static constexpr bool IS_READER{false};
+
+    explicit Writer(SerializedInfo& output_) : output{output_} {}
+
+    void Flag(bool value) {
+        if (num_flags == 0) {
+            output.push_back(0);
+        }
+        if (value) {
+            output.back() = static_cast<u8>(output.back() | (1U << num_flags));
+        }
+        num_flags = (num_flags + 1) % 8;
+    }
+
+    template <typename T>
+    void Value(const T& value) {
+        if constexpr (std::is_enum_v<T>) {
+            Value(static_cast<std::underlying_type_t<T>>(value));
+        } else if constexpr (std::is_same_v<T, bool>) {
+            Value(static_cast<u8>(value ? 1 : 0));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            Value(std::bit_cast<std::conditional_t<sizeof(T) == 4, u32, u64>>(value));
+        } else {
+            static_assert(std::is_integral_v<T>);
+            const auto raw{static_cast<std::make_unsigned_t<T>>(value)};
+            for (size_t byte = 0; byte < sizeof(T); ++byte) {
+                output.push_back(static_cast<u8>(static_cast<u64>(raw) >> (byte * 8)));
+            }
+            num_flags = 0;
+        }
+    }
+
+    template <size_t N>
+    void Bits(const std::bitset<N>& bits) {
+        static const std::bitset<N> word_mask{~u64{}};
+        for (size_t bit = 0; bit < N; bit += 64) {
+            const u64 word{((bits >> bit) & word_mask).to_ullong()};
+            for (size_t byte = 0; byte < 8 && bit + byte * 8 < N; ++byte) {
+                output.push_back(static_cast<u8>(word >> (byte * 8)));
+            }
+        }
+        num_flags = 0;
+    }
+
+    template <typename Container>
+    size_t Size(Container& container) {
+        Value(static_cast<u32>(container.size()));
+        return container.size();
+    }
+
+    template <typename T>
+    void Optional(const std::optional<T>& value) {
+        Value(value.has_value());
+        if (value) {
+            Value(*value);
+        }
+    }
+
+private:
+    SerializedInfo& output;
+    u32 num_flags{};
+};
+
+/// Mirrors Writer, every read is bounds checked against the input
+class Reader {
+public:
+    static constexpr bool IS_READER{true};
+
+    explicit Reader(std::span<const u8> input_) : input{input_} {}
+
+    bool Flag() {
+        if (num_flags == 0) {
+            flags = Byte();
+        }
+        const bool value{((flags >> num_flags) & 1) != 0};
+        num_flags = (num_flags + 1) % 8;
+        return value;
+    }
+
+    template <typename T>
+    void Value(T& value) {
+        if constexpr (std::is_enum_v<T>) {
+            std::underlying_type_t<T> raw{};
+            Value(raw);
+            value = static_cast<T>(raw);
+        } else if constexpr (std::is_same_v<T, bool>) {
+            u8 raw{};
+            Value(raw);
+            if (raw > 1) {
+                throw InvalidArgument("Invalid boolean {} in serialized info", raw);
+            }
+            value = raw != 0;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            std::conditional_t<sizeof(T) == 4, u32, u64> raw{};
+            Value(raw);
+            value = std::bit_cast<T>(raw);
+        } else {
+            static_assert(std::is_integral_v<T>);
+            u64 raw{};
+            for (size_t byte = 0; byte < sizeof(T); ++byte) {
+                raw |= static_cast<u64>(Byte()) << (byte * 8);
+            }
+            value = static_cast<T>(static_cast<std::make_unsigned_t<T>>(raw));
+        }
+    }
+
+    template <size_t N>
+    void Bits(std::bitset<N>& bits) {
+        bits.reset();
+        for (size_t bit = 0; bit < N; bit += 64) {
+            u64 word{};
+            for (size_t byte = 0; byte < 8 && bit + byte * 8 < N; ++byte) {
+                word |= static_cast<u64>(Byte()) << (byte * 8);
+            }
+            bits |= std::bitset<N>{word} << bit;
+        }
+    }
+
+    template <typename Container>
+    size_t Size(Container& container) {
+        u32 size{};
+        Value(size);
+        // Every element takes at least one byte, this rejects bogus sizes before allocating
+        if (size > container.max_size() || size > input.size() - offset) {
+            throw InvalidArgument("Invalid container size {} in serialized info", size);
+        }
+        container.clear();
+        container.resize(size);
+        return size;
+    }
+
+    template <typename T>
+    void Optional(std::optional<T>& value) {
+        bool has_value{};
+        Value(has_value);
+        if (has_value) {
+            Value(value.emplace());
+        } else {
+            value.reset();
+        }
+    }
+
+    [[nodiscard]] bool AtEnd() const noexcept {
+        return offset == input.size();
+    }
+
+private:
+    u8 Byte() {
+        if (offset >= input.size()) {
+            throw InvalidArgument("Serialized info is truncated");
+        }
+        num_flags = 0;
+        return input[offset++];
+    }
+
+    std::span<const u8> input;
+    size_t offset{};
+    u8 flags{};
+    u32 num_flags{};
+};
+
+template <typename Archive>
+void Transfer(Archive& ar, ConstantBufferDescriptor& desc) {
+    ar.Value(desc.index);
+    ar.Value(desc.count);
+}
+
+template <typename Archive>
+void Transfer(Archive& ar, CbufAssumption& assumption) {
+    ar.Value(assumption.bank);
+    ar.Value(assumption.offset);
+    ar.Value(assumption.value);
+}
+
+template <typename Archive>
+void Transfer(Archive& ar, StorageBufferDescriptor& desc) {
+    ar.Value(desc.cbuf_index);
+    ar.Value(desc.cbuf_offset);
+    ar.Value(desc.count);
+    ar.Value(desc.is_written);
+}
+
+template <typename Archive>
+void Transfer(Archive& ar, TextureBufferDescriptor& desc) {
+    ar.Value(desc.has_secondary);
+    ar.Value(desc.cbuf_index);
+    ar.Value(desc.cbuf_offset);
+    ar.Value(desc.shift_left);
+    ar.Value(desc.secondary_cbuf_index);
+    ar.Value(desc.secondary_cbuf_offset);
+    ar.Value(desc.secondary_shift_left);
+    ar.Value(desc.count);
+    ar.Value(desc.size_shift);
+}
+
+template <typename Archive>
+void Transfer(Archive& ar, ImageBufferDescriptor& desc) {
+    ar.Value(desc.format);
+    ar.Value(desc.is_written);
+    ar.Value(desc.is_read);
+    ar.Value(desc.cbuf_index);
+    ar.Value(desc.cbuf_offset);
+    ar.Value(desc.count);
+    ar.Value(desc.size_shift);
+}
+
+template <typename Archive>
+void Transfer(Archive& ar, TextureDescriptor& desc) {
+    ar.Value(desc.type);
+    ar.Value(desc.is_depth);
+    ar.Value(desc.has_secondary);
+    ar.Value(desc.cbuf_index);
+    ar.Value(desc.cbuf_offset);
+    ar.Value(desc.shift_left);
+    ar.Value(desc.secondary_cbuf_index);
+    ar.Value(desc.secondary_cbuf_offset);
+    ar.Value(desc.secondary_shift_left);
+    ar.Value(desc.count);
+    ar.Value(desc.size_shift);
+}
+
+template <typename Archive>
+void Transfer(Archive& ar, ImageDescriptor& desc) {
+    ar.Value(desc.type);
+    ar.Value(desc.format);
+    ar.Value(desc.is_written);
+    ar.Value(desc.is_read);
+    ar.Value(desc.cbuf_index);
+    ar.Value(desc.cbuf_offset);
+    ar.Value(desc.count);
+    ar.Value(desc.size_shift);
+}
+
+template <typename Archive>
+void Transfer(Archive& ar, TransformFeedbackOutput& output) {
+    ar.Value(output.attribute);
+    ar.Value(output.components);
+    ar.Value(output.buffer);
+    ar.Value(output.stride);
+    ar.Value(output.offset);
+}
+
+template <typename Archive, typename Container>
+void TransferList(Archive& ar, Container& container) {
+    ar.Size(container);
+    for (auto& element : container) {
+        Transfer(ar, element);
+    }
+}
+
+template <typename Archive>
+void TransferMapping(Archive& ar, IR::AttributeMapping& mapping) {
+    if constexpr (Archive::IS_READER) {
+        u32 size{};
+        ar.Value(size);
+        mapping.clear();
+        for (u32 index = 0; index < size; ++index) {
+            IR::Attribute key{};
+            IR::Attribute value{};
+            ar.Value(key);
+            ar.Value(value);
+            mapping.emplace_hint(mapping.end(), key, value);
+        }
+    } else {
+        ar.Value(static_cast<u32>(mapping.size()));
+        for (const auto& [key, value] : mapping) {
+            ar.Value(key);
+            ar.Value(value);
+        }
+    }
+}
+
+// Bitfields can't be bound to references, so flags go through a macro instead of the archive
+#define TRANSFER_FLAG(name)                                                                        \
+    if constexpr (Archive::IS_READER) {                                                            \
+        info.name = ar.Flag();                                                                     \
+    } else {                                                                                       \
+        ar.Flag(info.name);                                                                        \
+    }
+
+// Writers only read from the info, it is taken as mutable to share the code with readers
+template <typename Archive>
+void Transfer(Archive& ar, Info& info) {
+    TRANSFER_FLAG(uses_workgroup_id)
+    TRANSFER_FLAG(uses_local_invocation_id)
+    TRANSFER_FLAG(uses_invocation_id)
+    TRANSFER_FLAG(uses_invocation_info)
+    TRANSFER_FLAG(uses_sample_id)
+    TRANSFER_FLAG(uses_is_helper_invocation)
+    TRANSFER_FLAG(uses_subgroup_invocation_id)
+    TRANSFER_FLAG(uses_subgroup_shuffles)
+    TRANSFER_FLAG(loads_indexed_attributes)
+    TRANSFER_FLAG(stores_sample_mask)
+    TRANSFER_FLAG(stores_frag_depth)
+    TRANSFER_FLAG(stores_tess_level_outer)
+    TRANSFER_FLAG(stores_tess_level_inner)
+    TRANSFER_FLAG(stores_indexed_attributes)
+    TRANSFER_FLAG(stores_global_memory)
+    TRANSFER_FLAG(uses_fp16)
+    TRANSFER_FLAG(uses_fp64)
+    TRANSFER_FLAG(uses_fp16_denorms_flush)
+    TRANSFER_FLAG(uses_fp16_denorms_preserve)
+    TRANSFER_FLAG(uses_fp32_denorms_flush)
+    TRANSFER_FLAG(uses_fp32_denorms_preserve)
+    TRANSFER_FLAG(uses_int8)
+    TRANSFER_FLAG(uses_int16)
+    TRANSFER_FLAG(uses_int64)
+    TRANSFER_FLAG(uses_image_1d)
+    TRANSFER_FLAG(uses_sampled_1d)
+    TRANSFER_FLAG(uses_sparse_residency)
+    TRANSFER_FLAG(uses_demote_to_helper_invocation)
+    TRANSFER_FLAG(uses_subgroup_vote)
+    TRANSFER_FLAG(uses_subgroup_mask)
+    TRANSFER_FLAG(uses_fswzadd)
+    TRANSFER_FLAG(uses_derivatives)
+    TRANSFER_FLAG(uses_typeless_image_reads)
+    TRANSFER_FLAG(uses_typeless_image_writes)
+    TRANSFER_FLAG(uses_image_buffers)
+    TRANSFER_FLAG(uses_shared_increment)
+    TRANSFER_FLAG(uses_shared_decrement)
+    TRANSFER_FLAG(uses_shared_atomic_aggregation)
+    TRANSFER_FLAG(uses_shared_aggregated_iadd)
+    TRANSFER_FLAG(uses_shared_aggregated_smin)
+    TRANSFER_FLAG(uses_shared_aggregated_umin)
+    TRANSFER_FLAG(uses_shared_aggregated_smax)
+    TRANSFER_FLAG(uses_shared_aggregated_umax)
+    TRANSFER_FLAG(uses_shared_aggregated_and)
+    TRANSFER_FLAG(uses_shared_aggregated_or)
+    TRANSFER_FLAG(uses_shared_aggregated_xor)
+    TRANSFER_FLAG(uses_global_increment)
+    TRANSFER_FLAG(uses_global_decrement)
+    TRANSFER_FLAG(uses_atomic_f32_add)
+    TRANSFER_FLAG(uses_atomic_f16x2_add)
+    TRANSFER_FLAG(uses_atomic_f16x2_min)
+    TRANSFER_FLAG(uses_atomic_f16x2_max)
+    TRANSFER_FLAG(uses_atomic_f32x2_add)
+    TRANSFER_FLAG(uses_atomic_f32x2_min)
+    TRANSFER_FLAG(uses_atomic_f32x2_max)
+    TRANSFER_FLAG(uses_atomic_s32_min)
+    TRANSFER_FLAG(uses_atomic_s32_max)
+    TRANSFER_FLAG(uses_int64_bit_atomics)
+    TRANSFER_FLAG(uses_global_memory)
+    TRANSFER_FLAG(uses_atomic_image_u32)
+    TRANSFER_FLAG(uses_shadow_lod)
+    TRANSFER_FLAG(uses_rescaling_uniform)
+    TRANSFER_FLAG(uses_cbuf_indirect)
+    TRANSFER_FLAG(uses_render_area)
+    TRANSFER_FLAG(requires_layer_emulation)
+
+    ar.Bits(info.uses_patches);
+    for (Interpolation& interpolation : info.interpolation) {
+        ar.Value(interpolation);
+    }
+    ar.Bits(info.loads.mask);
+    ar.Bits(info.stores.mask);
+    ar.Bits(info.passthrough.mask);
+    TransferMapping(ar, info.legacy_stores_mapping);
+    ar.Bits(info.stores_frag_color);
+
+    ar.Value(info.used_constant_buffer_types);
+    ar.Value(info.used_storage_buffer_types);
+    ar.Value(info.used_indirect_cbuf_types);
+
+    ar.Value(info.constant_buffer_mask);
+    ar.Value(info.indirect_constant_buffer_mask);
+    for (u32& used_size : info.constant_buffer_used_sizes) {
+        ar.Value(used_size);
+    }
+    ar.Value(info.nvn_buffer_base);
+    ar.Bits(info.nvn_buffer_used);
+    TransferList(ar, info.cbuf_assumptions);
+    ar.Value(info.emulated_layer);
+
+    TransferList(ar, info.constant_buffer_descriptors);
+    TransferList(ar, info.storage_buffers_descriptors);
+    TransferList(ar, info.texture_buffer_descriptors);
+    TransferList(ar, info.image_buffer_descriptors);
+    TransferList(ar, info.texture_descriptors);
+    TransferList(ar, info.image_descriptors);
+}
+
+#undef TRANSFER_FLAG
+
+template <typename Archive>
+void Transfer(Archive& ar, RuntimeInfo& info) {
+    for (AttributeType& type : info.generic_input_types) {
+        ar.Value(type);
+    }
+    ar.Bits(info.previous_stage_stores.mask);
+    TransferMapping(ar, info.previous_stage_legacy_stores_mapping);
+
+    ar.Value(info.convert_depth_mode);
+    ar.Value(info.force_early_z);
+    ar.Value(info.tess_primitive);
+    ar.Value(info.tess_spacing);
+    ar.Value(info.tess_clockwise);
+    ar.Value(info.input_topology);
+    ar.Optional(info.fixed_state_point_size);
+    ar.Optional(info.alpha_test_func);
+    ar.Value(info.alpha_test_reference);
+    ar.Value(info.y_negate);
+    ar.Value(info.glasm_use_storage_buffers);
+
+    TransferList(ar, info.xfb_layout.outputs);
+    ar.Value(info.xfb_layout.hash);
+}
+
+template <typename T>
+void SerializeImpl(const T& info, SerializedInfo& output) {
+    Writer writer{output};
+    writer.Value(INFO_SERIALIZATION_VERSION);
+    Transfer(writer, const_cast<T&>(info));
+}
+
+template <typename T>
+T DeserializeImpl(std::span<const u8> data) {
+    Reader reader{data};
+    u32 version{};
+    reader.Value(version);
+    if (version != INFO_SERIALIZATION_VERSION) {
+        throw InvalidArgument("Serialized info version {} is not {}", version,
+                              INFO_SERIALIZATION_VERSION);
+    }
+    T info{};
+    Transfer(reader, info);
+    if (!reader.AtEnd()) {
+        throw InvalidArgument("Serialized info has trailing data");
+    }
+    return info;
+}
+
+template <typename T>
+Hash128 HashImpl(const T& info) {
+    SerializedInfo buffer;
+    SerializeImpl(info, buffer);
+    return HashBytes({buffer.data(), buffer.size()});
+}
+} // Anonymous namespace
+
+void Serialize(const Info& info, SerializedInfo& output) {
+    SerializeImpl(info, output);
+}
+
+void Serialize(const RuntimeInfo& runtime_info, SerializedInfo& output) {
+    SerializeImpl(runtime_info, output);
+}
+
+Info DeserializeInfo(std::span<const u8> data) {
+    return DeserializeImpl<Info>(data);
+}
+
+RuntimeInfo DeserializeRuntimeInfo(std::span<const u8> data) {
+    return DeserializeImpl<RuntimeInfo>(data);
+}
+
+Hash128 Hash(const Info& info) {
+    return HashImpl(info);
+}
+
+Hash128 Hash(const RuntimeInfo& runtime_info) {
+    return HashImpl(runtime_info);
+}
+
+} // namespace Shader
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+
+#include <boost/container/small_vector.hpp>
+
+#include <shader_compiler/common/common_types.h>
+#include <shader_compiler/common/hash.h>
+#include <shader_compiler/runtime_info.h>
+#include <shader_compiler/shader_info.h>
+
+namespace Shader {
+
+/// Bumped whenever the binary layout below changes, serialized data of other versions is rejected
+constexpr u32 INFO_SERIALIZATION_VERSION{5};
+
+/// Output buffer of the serializers, the common Info fits without allocating
+using SerializedInfo = boost::container::small_vector<u8, 1024>;
+
+/// Appends a host independent binary representation of the given info to the output
+void Serialize(const Info& info, SerializedInfo& output);
+void Serialize(const RuntimeInfo& runtime_info, SerializedInfo& output);
+
+/// Reconstructs the info from data written by Serialize
+/// @throws InvalidArgument when the data is truncated or of a different version
+[[nodiscard]] Info DeserializeInfo(std::span<const u8> data);
+[[nodiscard]] RuntimeInfo DeserializeRuntimeInfo(std::span<const u8> data);
+
+/// Hash of the serialized representation, stable across hosts and runs so it can key on-disk
+/// caches, equal infos always have equal hashes
+[[nodiscard]] Hash128 Hash(const Info& info);
+[[nodiscard]] Hash128 Hash(const RuntimeInfo& runtime_info);
+
+} // namespace Shader
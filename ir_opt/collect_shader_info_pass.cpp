@@ -1,13 +1,18 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <optional>
+
 #include <range/v3/algorithm.hpp>
 #include <shader_compiler/common/alignment.h>
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/environment.h>
 #include <shader_compiler/frontend/ir/modifiers.h>
 #include <shader_compiler/frontend/ir/program.h>
 #include <shader_compiler/frontend/ir/value.h>
 #include <shader_compiler/ir_opt/passes.h>
+#include <shader_compiler/ir_opt/value_bounds.h>
 #include <shader_compiler/shader_info.h>
 
 namespace Shader::Optimization {
@@ -29,14 +34,30 @@ void AddConstantBufferDescriptor(Info& info, u32 index, u32 count) {
                  });
 }
 
-void AddRegisterIndexedLdc(Info& info) {
+constexpr u32 MAX_CBUF_SIZE{0x10'000};
+
+/// Returns the amount of bytes from the start of a constant buffer an access can reach
+u32 UsedSize(const IR::Value& offset, u32 element_size) {
+    const std::optional<u32> max_offset{UpperBound(offset)};
+    if (!max_offset || *max_offset >= MAX_CBUF_SIZE) {
+        return MAX_CBUF_SIZE;
+    }
+    return std::min(Common::AlignUp(*max_offset + element_size, 16u), MAX_CBUF_SIZE);
+}
+
+void AddRegisterIndexedLdc(Info& info, u32 cbuf_mask, u32 used_size) {
     info.uses_cbuf_indirect = true;
+    info.indirect_constant_buffer_mask |= cbuf_mask;
 
     for (u32 i = 0; i < Info::MAX_INDIRECT_CBUFS; i++) {
+        if (((cbuf_mask >> i) & 1) == 0) {
+            continue;
+        }
         AddConstantBufferDescriptor(info, i, 1);
 
-        // The shader can use any possible access size
-        info.constant_buffer_used_sizes[i] = 0x10'000;
+        // The buffer index is not known, so any reachable one can be accessed up to the bound
+        u32& size{info.constant_buffer_used_sizes[i]};
+        size = std::max(size, used_size);
     }
 }
 
@@ -68,12 +89,12 @@ void GetPatch(Info& info, IR::Patch patch) {
     if (!IR::IsGeneric(patch)) {
         throw NotImplementedException("Reading non-generic patch {}", patch);
     }
-    info.uses_patches.at(IR::GenericPatchIndex(patch)) = true;
+    info.uses_patches.set(IR::GenericPatchIndex(patch));
 }
 
 void SetPatch(Info& info, IR::Patch patch) {
     if (IR::IsGeneric(patch)) {
-        info.uses_patches.at(IR::GenericPatchIndex(patch)) = true;
+        info.uses_patches.set(IR::GenericPatchIndex(patch));
         return;
     }
     switch (patch) {
@@ -150,13 +171,17 @@ void VisitUsages(Info& info, IR::Inst& inst) {
     case IR::Opcode::ConvertF32F16:
     case IR::Opcode::FPAbs16:
     case IR::Opcode::FPAdd16:
+    case IR::Opcode::FPAdd16x2:
     case IR::Opcode::FPCeil16:
     case IR::Opcode::FPFloor16:
     case IR::Opcode::FPFma16:
+    case IR::Opcode::FPFma16x2:
     case IR::Opcode::FPMul16:
+    case IR::Opcode::FPMul16x2:
     case IR::Opcode::FPNeg16:
     case IR::Opcode::FPRoundEven16:
     case IR::Opcode::FPSaturate16:
+    case IR::Opcode::FPSaturate16x2:
     case IR::Opcode::FPClamp16:
     case IR::Opcode::FPTrunc16:
     case IR::Opcode::FPOrdEqual16:
@@ -508,11 +533,13 @@ void VisitUsages(Info& info, IR::Inst& inst) {
             if (offset.IsImmediate()) {
                 size = Common::AlignUp(std::max(size, offset.U32() + element_size), 16u);
             } else {
-                size = 0x10'000;
+                size = std::max(size, UsedSize(offset, element_size));
             }
         } else {
-            AddRegisterIndexedLdc(info);
-            GetElementSize(info.used_indirect_cbuf_types, inst.GetOpcode());
+            const u32 element_size{
+                GetElementSize(info.used_indirect_cbuf_types, inst.GetOpcode())};
+            AddRegisterIndexedLdc(info, ReachableIndirectCbufs(index),
+                                  UsedSize(offset, element_size));
         }
         break;
     }
@@ -641,6 +668,40 @@ void VisitUsages(Info& info, IR::Inst& inst) {
     case IR::Opcode::SharedAtomicSMax32:
         info.uses_atomic_s32_max = true;
         break;
+    case IR::Opcode::SharedAtomicAggregatedIAdd32:
+        info.uses_shared_atomic_aggregation = true;
+        info.uses_shared_aggregated_iadd = true;
+        break;
+    case IR::Opcode::SharedAtomicAggregatedSMin32:
+        info.uses_atomic_s32_min = true;
+        info.uses_shared_atomic_aggregation = true;
+        info.uses_shared_aggregated_smin = true;
+        break;
+    case IR::Opcode::SharedAtomicAggregatedUMin32:
+        info.uses_shared_atomic_aggregation = true;
+        info.uses_shared_aggregated_umin = true;
+        break;
+    case IR::Opcode::SharedAtomicAggregatedSMax32:
+        info.uses_atomic_s32_max = true;
+        info.uses_shared_atomic_aggregation = true;
+        info.uses_shared_aggregated_smax = true;
+        break;
+    case IR::Opcode::SharedAtomicAggregatedUMax32:
+        info.uses_shared_atomic_aggregation = true;
+        info.uses_shared_aggregated_umax = true;
+        break;
+    case IR::Opcode::SharedAtomicAggregatedAnd32:
+        info.uses_shared_atomic_aggregation = true;
+        info.uses_shared_aggregated_and = true;
+        break;
+    case IR::Opcode::SharedAtomicAggregatedOr32:
+        info.uses_shared_atomic_aggregation = true;
+        info.uses_shared_aggregated_or = true;
+        break;
+    case IR::Opcode::SharedAtomicAggregatedXor32:
+        info.uses_shared_atomic_aggregation = true;
+        info.uses_shared_aggregated_xor = true;
+        break;
     case IR::Opcode::SharedAtomicInc32:
         info.uses_shared_increment = true;
         break;
@@ -766,8 +827,11 @@ void VisitUsages(Info& info, IR::Inst& inst) {
 void VisitFpModifiers(Info& info, IR::Inst& inst) {
     switch (inst.GetOpcode()) {
     case IR::Opcode::FPAdd16:
+    case IR::Opcode::FPAdd16x2:
     case IR::Opcode::FPFma16:
+    case IR::Opcode::FPFma16x2:
     case IR::Opcode::FPMul16:
+    case IR::Opcode::FPMul16x2:
     case IR::Opcode::FPRoundEven16:
     case IR::Opcode::FPFloor16:
     case IR::Opcode::FPCeil16:
@@ -787,8 +851,11 @@ void VisitFpModifiers(Info& info, IR::Inst& inst) {
         break;
     }
     case IR::Opcode::FPAdd32:
+    case IR::Opcode::FPAdd32x2:
     case IR::Opcode::FPFma32:
+    case IR::Opcode::FPFma32x2:
     case IR::Opcode::FPMul32:
+    case IR::Opcode::FPMul32x2:
     case IR::Opcode::FPRoundEven32:
     case IR::Opcode::FPFloor32:
     case IR::Opcode::FPCeil32:
@@ -936,6 +1003,7 @@ void GatherInfoFromHeader(Environment& env, Info& info) {
 } // Anonymous namespace
 
 void CollectShaderInfoPass(Environment& env, IR::Program& program) {
+    SHADER_TRACE_SCOPE("CollectShaderInfoPass");
     Info& info{program.info};
     const u32 base{[&] {
         switch (program.stage) {
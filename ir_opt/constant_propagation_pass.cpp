@@ -3,16 +3,20 @@
 
 #include <range/v3/algorithm.hpp>
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <functional>
 #include <tuple>
 #include <type_traits>
 
 #include <shader_compiler/common/bit_cast.h>
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/environment.h>
 #include <shader_compiler/exception.h>
 #include <shader_compiler/frontend/ir/ir_emitter.h>
 #include <shader_compiler/frontend/ir/value.h>
 #include <shader_compiler/ir_opt/passes.h>
+#include <shader_compiler/ir_opt/value_bounds.h>
 
 namespace Shader::Optimization {
 namespace {
@@ -444,6 +448,42 @@ void FoldFPMul32(IR::Inst& inst) {
     }
 }
 
+/// Sets the first argument of an instruction that ignores the sign of its operand to the value
+/// before any absolute or negate modifiers
+void StripSignModifiers(IR::Inst& inst) {
+    IR::Value value{inst.Arg(0)};
+    while (!value.IsImmediate()) {
+        IR::Inst* const source{value.InstRecursive()};
+        const IR::Opcode opcode{source->GetOpcode()};
+        if (opcode != IR::Opcode::FPAbs32 && opcode != IR::Opcode::FPNeg32) {
+            break;
+        }
+        value = source->Arg(0);
+    }
+    inst.SetArg(0, value);
+}
+
+void FoldFPAbs32(IR::Inst& inst) {
+    // Range reductions and MUFU both apply absolute and negate modifiers to the same value
+    StripSignModifiers(inst);
+}
+
+void FoldFPNeg32(IR::Inst& inst) {
+    const IR::Value value{inst.Arg(0)};
+    if (value.IsImmediate()) {
+        return;
+    }
+    IR::Inst* const source{value.InstRecursive()};
+    if (source->GetOpcode() == IR::Opcode::FPNeg32) {
+        inst.ReplaceUsesWith(source->Arg(0));
+    }
+}
+
+void FoldFPCos(IR::Inst& inst) {
+    // Cosine is even, sign modifiers left by the RRO and MUFU pair don't change the result
+    StripSignModifiers(inst);
+}
+
 void FoldLogicalAnd(IR::Inst& inst) {
     if (!FoldCommutative<bool>(inst, [](bool a, bool b) { return a && b; })) {
         return;
@@ -575,6 +615,60 @@ std::optional<IR::Value> FoldCompositeExtractImpl(IR::Value inst_value, IR::Opco
     return inst->Arg(1);
 }
 
+u32 EvalLut3(u32 a, u32 b, u32 c, u32 lut) {
+    u32 result{};
+    for (u32 index = 0; index < 8; ++index) {
+        if (((lut >> index) & 1) != 0) {
+            result |= ((index & 4) != 0 ? a : ~a) & ((index & 2) != 0 ? b : ~b) &
+                      ((index & 1) != 0 ? c : ~c);
+        }
+    }
+    return result;
+}
+
+void FoldBitwiseLut32(IR::Block& block, IR::Inst& inst) {
+    const auto eval{[](u32 a, u32 b, u32 c, u32 lut) { return EvalLut3(a, b, c, lut); }};
+    if (FoldWhenAllImmediates(inst, eval)) {
+        return;
+    }
+    // Bits of the truth table index selected by each operand
+    static constexpr std::array<u32, 3> index_bits{4, 2, 1};
+    const u32 original_lut{inst.Arg(3).U32()};
+    u32 lut{original_lut};
+    const auto remap{[&lut](auto&& index_func) {
+        u32 result{};
+        for (u32 index = 0; index < 8; ++index) {
+            result |= ((lut >> index_func(index)) & 1) << index;
+        }
+        lut = result;
+    }};
+    for (size_t i = 0; i < 3; ++i) {
+        const IR::Value operand{inst.Arg(i).Resolve()};
+        const u32 bit{index_bits[i]};
+        if (operand.IsImmediate() && operand.U32() == 0) {
+            remap([bit](u32 index) { return index & ~bit; });
+        } else if (operand.IsImmediate() && operand.U32() == 0xFFFFFFFF) {
+            remap([bit](u32 index) { return index | bit; });
+        }
+        for (size_t j = i + 1; j < 3; ++j) {
+            if (operand != inst.Arg(j).Resolve()) {
+                continue;
+            }
+            // Both operands always have the same bits, read the second from the first
+            const u32 other_bit{index_bits[j]};
+            remap([bit, other_bit](u32 index) {
+                return (index & bit) != 0 ? index | other_bit : index & ~other_bit;
+            });
+        }
+    }
+    if (lut == original_lut) {
+        return;
+    }
+    IR::IREmitter ir{block, IR::Block::InstructionList::s_iterator_to(inst)};
+    inst.ReplaceUsesWith(ir.BitwiseLut(IR::U32{inst.Arg(0)}, IR::U32{inst.Arg(1)},
+                                       IR::U32{inst.Arg(2)}, lut));
+}
+
 void FoldCompositeExtract(IR::Inst& inst, IR::Opcode construct, IR::Opcode insert) {
     const IR::Value value_1{inst.Arg(0)};
     const IR::Value value_2{inst.Arg(1)};
@@ -592,6 +686,31 @@ void FoldCompositeExtract(IR::Inst& inst, IR::Opcode construct, IR::Opcode inser
     inst.ReplaceUsesWith(*result);
 }
 
+/// Folds a vector constructed from the elements of another vector in order into that vector
+void FoldCompositeConstruct(IR::Inst& inst, IR::Opcode extract) {
+    IR::Value vector;
+    for (size_t index = 0; index < inst.NumArgs(); ++index) {
+        const IR::Value element{inst.Arg(index)};
+        if (element.IsImmediate()) {
+            return;
+        }
+        IR::Inst* const element_inst{element.InstRecursive()};
+        if (element_inst->GetOpcode() != extract) {
+            return;
+        }
+        const IR::Value element_index{element_inst->Arg(1)};
+        if (!element_index.IsImmediate() || element_index.U32() != index) {
+            return;
+        }
+        const IR::Value source{element_inst->Arg(0).Resolve()};
+        if (index != 0 && source != vector) {
+            return;
+        }
+        vector = source;
+    }
+    inst.ReplaceUsesWith(vector);
+}
+
 IR::Value GetThroughCast(IR::Value value, IR::Opcode expected_cast) {
     if (value.IsImmediate()) {
         return value;
@@ -705,7 +824,63 @@ void FoldDriverConstBuffer(Environment& env, IR::Block& block, IR::Inst& inst, u
     }
 }
 
-void ConstantPropagation(Environment& env, IR::Block& block, IR::Inst& inst) {
+void FoldIndexedAttribute(IR::Inst& inst) {
+    // Offsets that turned out to be constant don't need the generic indexed accessors the backends
+    // emit as a switch over every attribute, the arguments other than the offset are the same
+    const IR::Value offset{inst.Arg(0)};
+    if (!offset.IsImmediate() || offset.U32() % 4 != 0) {
+        return;
+    }
+    const IR::Attribute attribute{offset.U32() / 4};
+    if (!IR::IsGeneric(attribute)) {
+        return;
+    }
+    inst.ReplaceOpcode(inst.GetOpcode() == IR::Opcode::GetAttributeIndexed
+                           ? IR::Opcode::GetAttribute
+                           : IR::Opcode::SetAttribute);
+    inst.SetArg(0, IR::Value{attribute});
+}
+
+void FoldCbufBank(IR::Inst& inst) {
+    const IR::Value bank{inst.Arg(0)};
+    if (bank.IsImmediate()) {
+        return;
+    }
+    const u32 cbuf_mask{ReachableIndirectCbufs(bank)};
+    if (std::has_single_bit(cbuf_mask)) {
+        // Only one bank is reachable, turn the register indexed read into a direct one
+        inst.SetArg(0, IR::Value{static_cast<u32>(std::countr_zero(cbuf_mask))});
+    }
+}
+
+void FoldCbufAssumption(Environment& env, Info& info, IR::Inst& inst) {
+    if (inst.GetOpcode() != IR::Opcode::GetCbufU32 && inst.GetOpcode() != IR::Opcode::GetCbufF32) {
+        // Already replaced
+        return;
+    }
+    const IR::Value bank{inst.Arg(0)};
+    const IR::Value offset{inst.Arg(1)};
+    if (!bank.IsImmediate() || !offset.IsImmediate()) {
+        return;
+    }
+    const std::optional<u32> value{env.GetCbufAssumption(bank.U32(), offset.U32())};
+    if (!value) {
+        return;
+    }
+    const CbufAssumption assumption{bank.U32(), offset.U32(), *value};
+    auto& assumptions{info.cbuf_assumptions};
+    const auto it{ranges::lower_bound(assumptions, assumption)};
+    if (it == assumptions.end() || *it != assumption) {
+        assumptions.insert(it, assumption);
+    }
+    if (inst.GetOpcode() == IR::Opcode::GetCbufU32) {
+        inst.ReplaceUsesWith(IR::Value{*value});
+    } else {
+        inst.ReplaceUsesWith(IR::Value{Common::BitCast<f32>(*value)});
+    }
+}
+
+void ConstantPropagation(Environment& env, Info& info, IR::Block& block, IR::Inst& inst) {
     switch (inst.GetOpcode()) {
     case IR::Opcode::GetRegister:
         return FoldGetRegister(inst);
@@ -735,6 +910,10 @@ void ConstantPropagation(Environment& env, IR::Block& block, IR::Inst& inst) {
         return FoldInverseFunc(inst, IR::Opcode::UnpackFloat2x16);
     case IR::Opcode::UnpackFloat2x16:
         return FoldInverseFunc(inst, IR::Opcode::PackFloat2x16);
+    case IR::Opcode::PackDouble2x32:
+        return FoldInverseFunc(inst, IR::Opcode::UnpackDouble2x32);
+    case IR::Opcode::UnpackDouble2x32:
+        return FoldInverseFunc(inst, IR::Opcode::PackDouble2x32);
     case IR::Opcode::SelectU1:
     case IR::Opcode::SelectU8:
     case IR::Opcode::SelectU16:
@@ -746,6 +925,12 @@ void ConstantPropagation(Environment& env, IR::Block& block, IR::Inst& inst) {
         return FoldSelect(inst);
     case IR::Opcode::FPMul32:
         return FoldFPMul32(inst);
+    case IR::Opcode::FPAbs32:
+        return FoldFPAbs32(inst);
+    case IR::Opcode::FPNeg32:
+        return FoldFPNeg32(inst);
+    case IR::Opcode::FPCos:
+        return FoldFPCos(inst);
     case IR::Opcode::LogicalAnd:
         return FoldLogicalAnd(inst);
     case IR::Opcode::LogicalOr:
@@ -791,6 +976,8 @@ void ConstantPropagation(Environment& env, IR::Block& block, IR::Inst& inst) {
     case IR::Opcode::BitwiseXor32:
         FoldWhenAllImmediates(inst, [](u32 a, u32 b) { return a ^ b; });
         return;
+    case IR::Opcode::BitwiseLut32:
+        return FoldBitwiseLut32(block, inst);
     case IR::Opcode::BitFieldUExtract:
         FoldWhenAllImmediates(inst, [](u32 base, u32 shift, u32 count) {
             if (static_cast<size_t>(shift) + static_cast<size_t>(count) > 32) {
@@ -821,6 +1008,8 @@ void ConstantPropagation(Environment& env, IR::Block& block, IR::Inst& inst) {
             return (base & ~(~(~0u << bits) << offset)) | (insert << offset);
         });
         return;
+    case IR::Opcode::CompositeConstructU32x2:
+        return FoldCompositeConstruct(inst, IR::Opcode::CompositeExtractU32x2);
     case IR::Opcode::CompositeExtractU32x2:
         return FoldCompositeExtract(inst, IR::Opcode::CompositeConstructU32x2,
                                     IR::Opcode::CompositeInsertU32x2);
@@ -850,14 +1039,26 @@ void ConstantPropagation(Environment& env, IR::Block& block, IR::Inst& inst) {
                                     IR::Opcode::CompositeInsertF16x4);
     case IR::Opcode::FSwizzleAdd:
         return FoldFSwizzleAdd(block, inst);
+    case IR::Opcode::GetAttributeIndexed:
+    case IR::Opcode::SetAttributeIndexed:
+        return FoldIndexedAttribute(inst);
+    case IR::Opcode::GetCbufU8:
+    case IR::Opcode::GetCbufS8:
+    case IR::Opcode::GetCbufU16:
+    case IR::Opcode::GetCbufS16:
+    case IR::Opcode::GetCbufU32x2:
+        FoldCbufBank(inst);
+        break;
     case IR::Opcode::GetCbufF32:
     case IR::Opcode::GetCbufU32:
+        FoldCbufBank(inst);
         if (env.HasHLEMacroState()) {
             FoldConstBuffer(env, block, inst);
         }
         if (env.IsPropietaryDriver()) {
             FoldDriverConstBuffer(env, block, inst, 1);
         }
+        FoldCbufAssumption(env, info, inst);
         break;
     default:
         break;
@@ -867,11 +1068,12 @@ void ConstantPropagation(Environment& env, IR::Block& block, IR::Inst& inst) {
 } // Anonymous namespace
 
 void ConstantPropagationPass(Environment& env, IR::Program& program) {
+    SHADER_TRACE_SCOPE("ConstantPropagationPass");
     const auto end{program.post_order_blocks.rend()};
     for (auto it = program.post_order_blocks.rbegin(); it != end; ++it) {
         IR::Block* const block{*it};
         for (IR::Inst& inst : block->Instructions()) {
-            ConstantPropagation(env, *block, inst);
+            ConstantPropagation(env, program.info, *block, inst);
         }
     }
 }
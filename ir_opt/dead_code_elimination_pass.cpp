@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
 #include <shader_compiler/frontend/ir/value.h>
 #include <shader_compiler/ir_opt/passes.h>
@@ -8,6 +9,7 @@
 namespace Shader::Optimization {
 
 void DeadCodeEliminationPass(IR::Program& program) {
+    SHADER_TRACE_SCOPE("DeadCodeEliminationPass");
     // We iterate over the instructions in reverse order.
     // This is because removing an instruction reduces the number of uses for earlier instructions.
     for (IR::Block* const block : program.post_order_blocks) {
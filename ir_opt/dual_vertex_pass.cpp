@@ -1,12 +1,14 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/frontend/ir/ir_emitter.h>
 #include <shader_compiler/ir_opt/passes.h>
 
 namespace Shader::Optimization {
 
 void VertexATransformPass(IR::Program& program) {
+    SHADER_TRACE_SCOPE("VertexATransformPass");
     for (IR::Block* const block : program.blocks) {
         for (IR::Inst& inst : block->Instructions()) {
             if (inst.GetOpcode() == IR::Opcode::Epilogue) {
@@ -17,6 +19,7 @@ void VertexATransformPass(IR::Program& program) {
 }
 
 void VertexBTransformPass(IR::Program& program) {
+    SHADER_TRACE_SCOPE("VertexBTransformPass");
     for (IR::Block* const block : program.blocks) {
         for (IR::Inst& inst : block->Instructions()) {
             if (inst.GetOpcode() == IR::Opcode::Prologue) {
@@ -8,6 +8,7 @@
 #include <boost/container/small_vector.hpp>
 
 #include <shader_compiler/common/alignment.h>
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
 #include <shader_compiler/frontend/ir/breadth_first_search.h>
 #include <shader_compiler/frontend/ir/ir_emitter.h>
@@ -516,6 +517,7 @@ void Replace(IR::Block& block, IR::Inst& inst, const IR::U32& storage_index,
 } // Anonymous namespace
 
 void GlobalMemoryToStorageBufferPass(IR::Program& program, const HostTranslateInfo& host_info) {
+    SHADER_TRACE_SCOPE("GlobalMemoryToStorageBufferPass");
     StorageInfo info;
     for (IR::Block* const block : program.post_order_blocks) {
         for (IR::Inst& inst : block->Instructions()) {
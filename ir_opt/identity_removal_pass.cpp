@@ -3,6 +3,7 @@
 
 #include <vector>
 
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
 #include <shader_compiler/frontend/ir/value.h>
 #include <shader_compiler/ir_opt/passes.h>
@@ -10,6 +11,7 @@
 namespace Shader::Optimization {
 
 void IdentityRemovalPass(IR::Program& program) {
+    SHADER_TRACE_SCOPE("IdentityRemovalPass");
     std::vector<IR::Inst*> to_invalidate;
     for (IR::Block* const block : program.blocks) {
         for (auto inst = block->begin(); inst != block->end();) {
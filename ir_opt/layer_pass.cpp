@@ -7,6 +7,7 @@
 
 #include <boost/container/small_vector.hpp>
 
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/environment.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
 #include <shader_compiler/frontend/ir/breadth_first_search.h>
@@ -39,6 +40,7 @@ static bool PermittedProgramStage(Stage stage) {
 }
 
 void LayerPass(IR::Program& program, const HostTranslateInfo& host_info) {
+    SHADER_TRACE_SCOPE("LayerPass");
     if (host_info.support_viewport_index_layer || !PermittedProgramStage(program.stage)) {
         return;
     }
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/frontend/ir/value.h>
 #include <shader_compiler/ir_opt/passes.h>
 
@@ -12,20 +13,28 @@ IR::Opcode Replace(IR::Opcode op) {
         return IR::Opcode::FPAbs32;
     case IR::Opcode::FPAdd16:
         return IR::Opcode::FPAdd32;
+    case IR::Opcode::FPAdd16x2:
+        return IR::Opcode::FPAdd32x2;
     case IR::Opcode::FPCeil16:
         return IR::Opcode::FPCeil32;
     case IR::Opcode::FPFloor16:
         return IR::Opcode::FPFloor32;
     case IR::Opcode::FPFma16:
         return IR::Opcode::FPFma32;
+    case IR::Opcode::FPFma16x2:
+        return IR::Opcode::FPFma32x2;
     case IR::Opcode::FPMul16:
         return IR::Opcode::FPMul32;
+    case IR::Opcode::FPMul16x2:
+        return IR::Opcode::FPMul32x2;
     case IR::Opcode::FPNeg16:
         return IR::Opcode::FPNeg32;
     case IR::Opcode::FPRoundEven16:
         return IR::Opcode::FPRoundEven32;
     case IR::Opcode::FPSaturate16:
         return IR::Opcode::FPSaturate32;
+    case IR::Opcode::FPSaturate16x2:
+        return IR::Opcode::FPSaturate32x2;
     case IR::Opcode::FPClamp16:
         return IR::Opcode::FPClamp32;
     case IR::Opcode::FPTrunc16:
@@ -129,6 +138,7 @@ IR::Opcode Replace(IR::Opcode op) {
 } // Anonymous namespace
 
 void LowerFp16ToFp32(IR::Program& program) {
+    SHADER_TRACE_SCOPE("LowerFp16ToFp32");
     for (IR::Block* const block : program.blocks) {
         for (IR::Inst& inst : block->Instructions()) {
             inst.ReplaceOpcode(Replace(inst.GetOpcode()));
@@ -0,0 +1,489 @@
+// SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Emulates 64-bit float arithmetic with double-float pairs, a value is represented as the
+// unevaluated sum hi + lo of two 32-bit floats with |lo| <= ulp(hi) / 2. Precision tradeoffs
+// compared to FP64:
+//
+// - The significand has 48 bits instead of 53, add and mul are within a few ulps of that precision
+//   and values split from native FP64 keep 47 bits
+// - The exponent range is the one of FP32, values beyond it overflow to infinity and values below
+//   it lose precision or flush to zero
+// - Guest rounding modes are ignored and results are computed as if rounded to nearest
+// - FMA is not fused, it's computed as a double-float multiplication followed by an addition
+// - Reciprocals refine the FP32 estimate with a single Newton-Raphson step
+// - RoundEven only resolves ties exactly when they are visible in the high word
+//
+// Values are split into pairs and joined back with integer operations on their 2x32 words, so FP64
+// values read from and written to registers or memory need no FP64 instruction. Conversions and
+// other instructions that are not lowered keep their native operands and results. The pass runs
+// after the SSA rewrite and constant propagation, which fold the register round trips between
+// FP64 instructions, so chains of lowered instructions pass pairs directly and the joins they
+// don't need are removed by dead code elimination.
+
+#include <cmath>
+#include <unordered_map>
+
+#include <shader_compiler/common/trace.h>
+#include <shader_compiler/exception.h>
+#include <shader_compiler/frontend/ir/basic_block.h>
+#include <shader_compiler/frontend/ir/ir_emitter.h>
+#include <shader_compiler/frontend/ir/program.h>
+#include <shader_compiler/frontend/ir/value.h>
+#include <shader_compiler/ir_opt/passes.h>
+
+namespace Shader::Optimization {
+namespace {
+/// Error free transformations rely on every operation being rounded individually
+constexpr IR::FpControl EXACT{.no_contraction = true};
+
+struct DoubleFloat {
+    IR::F32 hi;
+    IR::F32 lo;
+};
+
+IR::F32 Add(IR::IREmitter& ir, const IR::F32& a, const IR::F32& b) {
+    return IR::F32{ir.FPAdd(a, b, EXACT)};
+}
+
+IR::F32 Sub(IR::IREmitter& ir, const IR::F32& a, const IR::F32& b) {
+    return IR::F32{ir.FPAdd(a, IR::F32{ir.FPNeg(b)}, EXACT)};
+}
+
+IR::U1 IsFinite(IR::IREmitter& ir, const IR::F32& value) {
+    // Test the exponent bits, host compilers may fold x - x == 0 to true under fast math
+    const IR::U32 exponent{ir.BitwiseAnd(ir.BitCast<IR::U32>(value), ir.Imm32(0x7f800000))};
+    return ir.INotEqual(exponent, ir.Imm32(0x7f800000));
+}
+
+DoubleFloat Select(IR::IREmitter& ir, const IR::U1& condition, const DoubleFloat& true_value,
+                   const DoubleFloat& false_value) {
+    return {
+        IR::F32{ir.Select(condition, true_value.hi, false_value.hi)},
+        IR::F32{ir.Select(condition, true_value.lo, false_value.lo)},
+    };
+}
+
+/// Non-finite results keep the naive high word with a zero low word, the error terms would turn
+/// them into NaN. This also covers finite sums that overflow when renormalized
+DoubleFloat Finalize(IR::IREmitter& ir, const IR::F32& naive, const DoubleFloat& result) {
+    const IR::F32 hi{ir.Select(IsFinite(ir, naive), result.hi, naive)};
+    return {hi, IR::F32{ir.Select(IsFinite(ir, hi), result.lo, ir.Imm32(0.0f))}};
+}
+
+DoubleFloat TwoSum(IR::IREmitter& ir, const IR::F32& a, const IR::F32& b) {
+    const IR::F32 sum{Add(ir, a, b)};
+    const IR::F32 b_virtual{Sub(ir, sum, a)};
+    const IR::F32 a_virtual{Sub(ir, sum, b_virtual)};
+    const IR::F32 b_error{Sub(ir, b, b_virtual)};
+    const IR::F32 a_error{Sub(ir, a, a_virtual)};
+    return {sum, Add(ir, a_error, b_error)};
+}
+
+/// Requires |a| >= |b|
+DoubleFloat QuickTwoSum(IR::IREmitter& ir, const IR::F32& a, const IR::F32& b) {
+    const IR::F32 sum{Add(ir, a, b)};
+    return {sum, Sub(ir, b, Sub(ir, sum, a))};
+}
+
+DoubleFloat TwoProduct(IR::IREmitter& ir, const IR::F32& a, const IR::F32& b) {
+    const IR::F32 product{ir.FPMul(a, b, EXACT)};
+    return {product, IR::F32{ir.FPFma(a, b, IR::F32{ir.FPNeg(product)}, EXACT)}};
+}
+
+DoubleFloat Negate(IR::IREmitter& ir, const DoubleFloat& value) {
+    return {IR::F32{ir.FPNeg(value.hi)}, IR::F32{ir.FPNeg(value.lo)}};
+}
+
+DoubleFloat Add(IR::IREmitter& ir, const DoubleFloat& a, const DoubleFloat& b) {
+    const DoubleFloat hi_sum{TwoSum(ir, a.hi, b.hi)};
+    const DoubleFloat lo_sum{TwoSum(ir, a.lo, b.lo)};
+    DoubleFloat result{QuickTwoSum(ir, hi_sum.hi, Add(ir, hi_sum.lo, lo_sum.hi))};
+    result = QuickTwoSum(ir, result.hi, Add(ir, result.lo, lo_sum.lo));
+    return Finalize(ir, hi_sum.hi, result);
+}
+
+DoubleFloat Mul(IR::IREmitter& ir, const DoubleFloat& a, const DoubleFloat& b) {
+    const DoubleFloat product{TwoProduct(ir, a.hi, b.hi)};
+    IR::F32 error{ir.FPFma(a.hi, b.lo, product.lo, EXACT)};
+    error = IR::F32{ir.FPFma(a.lo, b.hi, error, EXACT)};
+    return Finalize(ir, product.hi, QuickTwoSum(ir, product.hi, error));
+}
+
+DoubleFloat Recip(IR::IREmitter& ir, const DoubleFloat& value) {
+    // q' = q + q * (1 - x * q)
+    const IR::F32 zero{ir.Imm32(0.0f)};
+    const IR::F32 estimate{ir.FPRecip(value.hi)};
+    const DoubleFloat q{estimate, zero};
+    const DoubleFloat residual{Add(ir, {ir.Imm32(1.0f), zero}, Negate(ir, Mul(ir, value, q)))};
+    const DoubleFloat result{Add(ir, q, Mul(ir, q, residual))};
+    const IR::U1 is_normal{ir.LogicalAnd(IsFinite(ir, estimate), ir.FPNotEqual(estimate, zero))};
+    return Select(ir, is_normal, result, q);
+}
+
+DoubleFloat RecipSqrt(IR::IREmitter& ir, const DoubleFloat& value) {
+    // y' = y + y / 2 * (1 - x * y * y)
+    const IR::F32 zero{ir.Imm32(0.0f)};
+    const IR::F32 estimate{ir.FPRecipSqrt(value.hi)};
+    const DoubleFloat y{estimate, zero};
+    const DoubleFloat square{Mul(ir, Mul(ir, value, y), y)};
+    const DoubleFloat residual{Add(ir, {ir.Imm32(1.0f), zero}, Negate(ir, square))};
+    const DoubleFloat half_y{IR::F32{ir.FPMul(estimate, ir.Imm32(0.5f), EXACT)}, zero};
+    const DoubleFloat result{Add(ir, y, Mul(ir, half_y, residual))};
+    const IR::U1 is_normal{ir.LogicalAnd(IsFinite(ir, estimate), ir.FPNotEqual(estimate, zero))};
+    return Select(ir, is_normal, result, y);
+}
+
+DoubleFloat Floor(IR::IREmitter& ir, const DoubleFloat& value) {
+    // The low word only matters when the high word is already integral
+    const IR::F32 hi_floor{ir.FPFloor(value.hi)};
+    const DoubleFloat integral{QuickTwoSum(ir, value.hi, IR::F32{ir.FPFloor(value.lo)})};
+    const DoubleFloat fractional{hi_floor, ir.Imm32(0.0f)};
+    const DoubleFloat result{Select(ir, ir.FPEqual(hi_floor, value.hi), integral, fractional)};
+    return Finalize(ir, value.hi, result);
+}
+
+DoubleFloat Ceil(IR::IREmitter& ir, const DoubleFloat& value) {
+    return Negate(ir, Floor(ir, Negate(ir, value)));
+}
+
+DoubleFloat Trunc(IR::IREmitter& ir, const DoubleFloat& value) {
+    const IR::U1 is_negative{ir.FPLessThan(value.hi, ir.Imm32(0.0f))};
+    return Select(ir, is_negative, Ceil(ir, value), Floor(ir, value));
+}
+
+DoubleFloat RoundEven(IR::IREmitter& ir, const DoubleFloat& value) {
+    const IR::F32 zero{ir.Imm32(0.0f)};
+    const IR::F32 hi_round{ir.FPRoundEven(value.hi)};
+    const DoubleFloat integral{QuickTwoSum(ir, value.hi, IR::F32{ir.FPRoundEven(value.lo)})};
+
+    // A high word halfway between two integers is exactly representable with a tiny low word,
+    // the sign of the low word decides the direction instead of the tie breaking rule
+    const IR::U1 is_tie{ir.FPEqual(IR::F32{ir.FPAbs(Sub(ir, hi_round, value.hi))}, ir.Imm32(0.5f))};
+    const IR::F32 rounded_up{Add(ir, value.hi, ir.Imm32(0.5f))};
+    const IR::F32 rounded_down{Sub(ir, value.hi, ir.Imm32(0.5f))};
+    IR::F32 tie_result{ir.Select(ir.FPLessThan(value.lo, zero), rounded_down, hi_round)};
+    tie_result = IR::F32{ir.Select(ir.FPGreaterThan(value.lo, zero), rounded_up, tie_result)};
+    const DoubleFloat fractional{IR::F32{ir.Select(is_tie, tie_result, hi_round)}, zero};
+
+    const DoubleFloat result{Select(ir, ir.FPEqual(hi_round, value.hi), integral, fractional)};
+    return Finalize(ir, value.hi, result);
+}
+
+IR::U1 Compare(IR::IREmitter& ir, IR::Opcode opcode, const DoubleFloat& a, const DoubleFloat& b) {
+    // Pairs are compared lexicographically, the low words only decide when the high words are
+    // equal. Non-finite high words always have zero low words, so low words are never NaN and the
+    // ordering of infinities and NaNs is decided by the high words alone
+    const IR::U1 hi_equal{ir.FPEqual(a.hi, b.hi)};
+    const auto tie{[&](const IR::U1& strict_hi, const IR::U1& lo) {
+        return ir.LogicalOr(strict_hi, ir.LogicalAnd(hi_equal, lo));
+    }};
+    switch (opcode) {
+    case IR::Opcode::FPOrdEqual64:
+        return ir.LogicalAnd(hi_equal, ir.FPEqual(a.lo, b.lo));
+    case IR::Opcode::FPUnordEqual64:
+        return tie(ir.FPUnordered(a.hi, b.hi), ir.FPEqual(a.lo, b.lo));
+    case IR::Opcode::FPOrdNotEqual64:
+        return tie(ir.FPNotEqual(a.hi, b.hi), ir.FPNotEqual(a.lo, b.lo));
+    case IR::Opcode::FPUnordNotEqual64:
+        return tie(ir.FPNotEqual(a.hi, b.hi, {}, false), ir.FPNotEqual(a.lo, b.lo));
+    case IR::Opcode::FPOrdLessThan64:
+        return tie(ir.FPLessThan(a.hi, b.hi), ir.FPLessThan(a.lo, b.lo));
+    case IR::Opcode::FPUnordLessThan64:
+        return tie(ir.FPLessThan(a.hi, b.hi, {}, false), ir.FPLessThan(a.lo, b.lo));
+    case IR::Opcode::FPOrdGreaterThan64:
+        return tie(ir.FPGreaterThan(a.hi, b.hi), ir.FPGreaterThan(a.lo, b.lo));
+    case IR::Opcode::FPUnordGreaterThan64:
+        return tie(ir.FPGreaterThan(a.hi, b.hi, {}, false), ir.FPGreaterThan(a.lo, b.lo));
+    case IR::Opcode::FPOrdLessThanEqual64:
+        return tie(ir.FPLessThan(a.hi, b.hi), ir.FPLessThanEqual(a.lo, b.lo));
+    case IR::Opcode::FPUnordLessThanEqual64:
+        return tie(ir.FPLessThan(a.hi, b.hi, {}, false), ir.FPLessThanEqual(a.lo, b.lo));
+    case IR::Opcode::FPOrdGreaterThanEqual64:
+        return tie(ir.FPGreaterThan(a.hi, b.hi), ir.FPGreaterThanEqual(a.lo, b.lo));
+    case IR::Opcode::FPUnordGreaterThanEqual64:
+        return tie(ir.FPGreaterThan(a.hi, b.hi, {}, false), ir.FPGreaterThanEqual(a.lo, b.lo));
+    default:
+        throw InvalidArgument("Invalid comparison {}", opcode);
+    }
+}
+
+DoubleFloat Min(IR::IREmitter& ir, const DoubleFloat& a, const DoubleFloat& b) {
+    // NaN operands are ignored like in the native instruction
+    const IR::U1 pick_b{ir.LogicalOr(Compare(ir, IR::Opcode::FPOrdLessThan64, b, a),
+                                     ir.FPIsNan(a.hi))};
+    return Select(ir, pick_b, b, a);
+}
+
+DoubleFloat Max(IR::IREmitter& ir, const DoubleFloat& a, const DoubleFloat& b) {
+    const IR::U1 pick_b{ir.LogicalOr(Compare(ir, IR::Opcode::FPOrdGreaterThan64, b, a),
+                                     ir.FPIsNan(a.hi))};
+    return Select(ir, pick_b, b, a);
+}
+
+DoubleFloat Clamp(IR::IREmitter& ir, const DoubleFloat& value, const DoubleFloat& min_value,
+                  const DoubleFloat& max_value) {
+    return Min(ir, Max(ir, value, min_value), max_value);
+}
+
+/// Splits the 2x32 words of a native FP64 value, the high word takes the top 24 bits of the
+/// significand and the low word the next 23. Values beyond the FP32 range overflow to infinity and
+/// values below the normal FP32 range flush to zero
+DoubleFloat SplitBits(IR::IREmitter& ir, const IR::Value& words) {
+    const IR::U32 low_word{ir.CompositeExtract(words, 0)};
+    const IR::U32 high_word{ir.CompositeExtract(words, 1)};
+    const IR::U32 sign{ir.BitwiseAnd(high_word, ir.Imm32(0x80000000))};
+    const IR::U32 exponent{ir.BitFieldExtract(high_word, ir.Imm32(20), ir.Imm32(11))};
+    const IR::U32 high_fraction{ir.BitFieldExtract(high_word, ir.Imm32(0), ir.Imm32(20))};
+    const IR::U1 is_nan{ir.LogicalAnd(
+        ir.IEqual(exponent, ir.Imm32(0x7ff)),
+        ir.INotEqual(ir.BitwiseOr(high_fraction, low_word), ir.Imm32(0)))};
+
+    // Rebias the exponent from 1023 to 127, the low word sits 23 bits below the high word
+    const IR::U32 hi_exponent{ir.ISub(exponent, ir.Imm32(1023 - 127))};
+    const IR::U32 lo_exponent{ir.ISub(hi_exponent, ir.Imm32(23))};
+    const IR::U32 hi_fraction{ir.BitwiseOr(ir.ShiftLeftLogical(high_fraction, ir.Imm32(3)),
+                                           ir.ShiftRightLogical(low_word, ir.Imm32(29)))};
+    const IR::U32 lo_fraction{ir.BitFieldExtract(low_word, ir.Imm32(6), ir.Imm32(23))};
+    const auto make_float{[&](const IR::U32& biased_exponent, const IR::U32& fraction) {
+        const IR::U32 exponent_bits{ir.ShiftLeftLogical(biased_exponent, ir.Imm32(23))};
+        return ir.BitCast<IR::F32>(ir.BitwiseOr(ir.BitwiseOr(sign, exponent_bits), fraction));
+    }};
+    // Both operands share sign and exponent, the subtraction leaves the fraction bits exactly
+    const IR::F32 zero{ir.Imm32(0.0f)};
+    const IR::F32 lo_value{Sub(ir, make_float(lo_exponent, lo_fraction),
+                               make_float(lo_exponent, ir.Imm32(0)))};
+    const IR::F32 lo{ir.Select(ir.IGreaterThan(lo_exponent, ir.Imm32(0), true), lo_value, zero)};
+
+    // The high word is truncated, renormalize it to nearest like the results of arithmetic
+    const DoubleFloat normal{QuickTwoSum(ir, make_float(hi_exponent, hi_fraction), lo)};
+    const IR::U32 special_bits{ir.Select(is_nan, ir.Imm32(0x7fc00000), ir.Imm32(0x7f800000))};
+    const DoubleFloat special{ir.BitCast<IR::F32>(ir.BitwiseOr(sign, special_bits)), zero};
+    const DoubleFloat signed_zero{ir.BitCast<IR::F32>(sign), zero};
+    const IR::U1 is_overflow{ir.IGreaterThanEqual(hi_exponent, ir.Imm32(0xff), true)};
+    const IR::U1 is_underflow{ir.ILessThanEqual(hi_exponent, ir.Imm32(0), true)};
+    return Select(ir, is_overflow, special, Select(ir, is_underflow, signed_zero, normal));
+}
+
+/// Rebuilds the 2x32 words of a native FP64 value from a pair
+IR::Value JoinBits(IR::IREmitter& ir, const DoubleFloat& value) {
+    const IR::U32 sign_mask{ir.Imm32(0x80000000)};
+    const IR::U32 hi_bits{ir.BitCast<IR::U32>(value.hi)};
+    const IR::U32 lo_bits{ir.BitCast<IR::U32>(value.lo)};
+    const IR::U32 sign{ir.BitwiseAnd(hi_bits, sign_mask)};
+    const IR::U32 exponent{ir.BitFieldExtract(hi_bits, ir.Imm32(23), ir.Imm32(8))};
+    const IR::U32 fraction{ir.BitFieldExtract(hi_bits, ir.Imm32(0), ir.Imm32(23))};
+
+    // A low word of the opposite sign borrows one ulp from the high word, so it only adds bits
+    const IR::U1 is_opposite{ir.LogicalAnd(
+        ir.INotEqual(ir.BitwiseAnd(ir.BitwiseXor(hi_bits, lo_bits), sign_mask), ir.Imm32(0)),
+        ir.INotEqual(ir.BitwiseAnd(lo_bits, ir.Imm32(0x7fffffff)), ir.Imm32(0)))};
+    const IR::F32 borrowed_hi{ir.BitCast<IR::F32>(IR::U32{ir.ISub(hi_bits, ir.Imm32(1))})};
+    const IR::F32 borrowed_lo{Add(ir, value.lo, Sub(ir, value.hi, borrowed_hi))};
+    const IR::U32 head{ir.Select(is_opposite, ir.BitCast<IR::U32>(borrowed_hi), hi_bits)};
+    const IR::U32 tail{ir.Select(is_opposite, ir.BitCast<IR::U32>(borrowed_lo), lo_bits)};
+    const IR::U32 head_exponent{ir.BitFieldExtract(head, ir.Imm32(23), ir.Imm32(8))};
+    const IR::U32 head_fraction{ir.BitFieldExtract(head, ir.Imm32(0), ir.Imm32(23))};
+    const IR::U32 tail_exponent{ir.BitFieldExtract(tail, ir.Imm32(23), ir.Imm32(8))};
+    const IR::U32 tail_significand{
+        ir.BitwiseOr(ir.BitFieldExtract(tail, ir.Imm32(0), ir.Imm32(23)), ir.Imm32(0x800000))};
+
+    // Align the tail significand to the last bit of the 52-bit fraction of the head
+    const IR::U32 shift{ir.ISub(ir.IAdd(tail_exponent, ir.Imm32(29)), head_exponent)};
+    const IR::U32 shifted_left{ir.ShiftLeftLogical(tail_significand, shift)};
+    const IR::U32 shifted_right{
+        ir.ShiftRightLogical(tail_significand, IR::U32{ir.ISub(ir.Imm32(0), shift)})};
+    const IR::U1 is_tail_zero{ir.LogicalOr(ir.IEqual(tail_exponent, ir.Imm32(0)),
+                                           ir.ILessThan(shift, ir.Imm32(-31), true))};
+    IR::U32 tail_fraction{ir.Select(ir.IGreaterThanEqual(shift, ir.Imm32(0), true),
+                                    shifted_left, shifted_right)};
+    tail_fraction = IR::U32{ir.Select(is_tail_zero, ir.Imm32(0), tail_fraction)};
+
+    // A carry out of the low word propagates into the exponent like a significand overflow
+    const IR::U32 head_low_bits{ir.ShiftLeftLogical(head_fraction, ir.Imm32(29))};
+    const IR::U32 low_word{ir.IAdd(head_low_bits, tail_fraction)};
+    const IR::U32 carry{ir.Select(ir.ILessThan(low_word, tail_fraction, false), ir.Imm32(1),
+                                  ir.Imm32(0))};
+    const IR::U32 biased_exponent{ir.IAdd(head_exponent, ir.Imm32(1023 - 127))};
+    const IR::U32 high_bits{ir.BitwiseOr(
+        ir.BitwiseOr(sign, ir.ShiftLeftLogical(biased_exponent, ir.Imm32(20))),
+        ir.ShiftRightLogical(head_fraction, ir.Imm32(3)))};
+    const IR::U32 high_word{ir.IAdd(high_bits, carry)};
+
+    // Zeros, denormals, infinities and NaNs are decided by the high word alone
+    const IR::U1 is_zero{ir.IEqual(exponent, ir.Imm32(0))};
+    const IR::U1 is_special{ir.IEqual(exponent, ir.Imm32(0xff))};
+    const IR::U32 nan_bit{
+        ir.Select(ir.INotEqual(fraction, ir.Imm32(0)), ir.Imm32(0x80000), ir.Imm32(0))};
+    const IR::U32 special_word{ir.BitwiseOr(ir.BitwiseOr(sign, ir.Imm32(0x7ff00000)), nan_bit)};
+    IR::U32 result_high{ir.Select(is_special, special_word, high_word)};
+    result_high = IR::U32{ir.Select(is_zero, sign, result_high)};
+    const IR::U32 result_low{
+        ir.Select(ir.LogicalOr(is_zero, is_special), ir.Imm32(0), low_word)};
+    return ir.CompositeConstruct(result_low, result_high);
+}
+
+class Lowering {
+public:
+    /// Returns the pair of a lowered instruction or splits a native FP64 value into one
+    DoubleFloat Split(IR::IREmitter& ir, const IR::Value& arg) {
+        const IR::Value value{arg.Resolve()};
+        if (value.IsImmediate()) {
+            const f64 immediate{value.F64()};
+            const f32 hi{static_cast<f32>(immediate)};
+            const f32 lo{std::isfinite(hi) ? static_cast<f32>(immediate - static_cast<f64>(hi))
+                                           : 0.0f};
+            return {ir.Imm32(hi), ir.Imm32(lo)};
+        }
+        IR::Inst* const native{value.InstRecursive()};
+        if (const auto it{pairs.find(native)}; it != pairs.end()) {
+            return it->second.pair;
+        }
+        if (native->GetOpcode() == IR::Opcode::PackDouble2x32) {
+            // Values read from registers and memory are split straight from their words
+            return SplitBits(ir, native->Arg(0));
+        }
+        return SplitBits(ir, ir.UnpackDouble2x32(IR::F64{value}));
+    }
+
+    /// Replaces the uses of the instruction with the native value of the pair, lowered users
+    /// retrieve the pair itself through Split and unpacks retrieve the words
+    void Join(IR::IREmitter& ir, IR::Inst& inst, const DoubleFloat& result) {
+        const IR::Value words{JoinBits(ir, result)};
+        const IR::F64 native{ir.PackDouble2x32(words)};
+        pairs.emplace(native.InstRecursive(), Joined{result, words});
+        inst.ReplaceUsesWith(native);
+    }
+
+    void Lower(IR::Block& block, IR::Inst& inst) {
+        const IR::Opcode opcode{inst.GetOpcode()};
+        if (opcode == IR::Opcode::UnpackDouble2x32) {
+            // Register and memory writes take the words directly and leave the pack unused
+            const IR::Value value{inst.Arg(0).Resolve()};
+            if (!value.IsImmediate()) {
+                if (const auto it{pairs.find(value.InstRecursive())}; it != pairs.end()) {
+                    inst.ReplaceUsesWith(it->second.words);
+                }
+            }
+            return;
+        }
+        if (!IsLowered(opcode)) {
+            return;
+        }
+        IR::IREmitter ir(block, IR::Block::InstructionList::s_iterator_to(inst));
+        const auto arg{[&](size_t index) { return Split(ir, inst.Arg(index)); }};
+        switch (opcode) {
+        case IR::Opcode::SelectF64:
+            if (!IsPair(inst.Arg(1)) && !IsPair(inst.Arg(2))) {
+                // Selecting between native values is cheaper than splitting them
+                return;
+            }
+            return Join(ir, inst, Select(ir, IR::U1{inst.Arg(0)}, arg(1), arg(2)));
+        case IR::Opcode::FPAbs64: {
+            const DoubleFloat value{arg(0)};
+            const IR::U1 is_negative{ir.FPLessThan(value.hi, ir.Imm32(0.0f))};
+            return Join(ir, inst, Select(ir, is_negative, Negate(ir, value), value));
+        }
+        case IR::Opcode::FPNeg64:
+            return Join(ir, inst, Negate(ir, arg(0)));
+        case IR::Opcode::FPAdd64:
+            return Join(ir, inst, Add(ir, arg(0), arg(1)));
+        case IR::Opcode::FPMul64:
+            return Join(ir, inst, Mul(ir, arg(0), arg(1)));
+        case IR::Opcode::FPFma64:
+            return Join(ir, inst, Add(ir, Mul(ir, arg(0), arg(1)), arg(2)));
+        case IR::Opcode::FPMin64:
+            return Join(ir, inst, Min(ir, arg(0), arg(1)));
+        case IR::Opcode::FPMax64:
+            return Join(ir, inst, Max(ir, arg(0), arg(1)));
+        case IR::Opcode::FPClamp64:
+            return Join(ir, inst, Clamp(ir, arg(0), arg(1), arg(2)));
+        case IR::Opcode::FPSaturate64: {
+            const IR::F32 zero{ir.Imm32(0.0f)};
+            return Join(ir, inst, Clamp(ir, arg(0), {zero, zero}, {ir.Imm32(1.0f), zero}));
+        }
+        case IR::Opcode::FPRecip64:
+            return Join(ir, inst, Recip(ir, arg(0)));
+        case IR::Opcode::FPRecipSqrt64:
+            return Join(ir, inst, RecipSqrt(ir, arg(0)));
+        case IR::Opcode::FPRoundEven64:
+            return Join(ir, inst, RoundEven(ir, arg(0)));
+        case IR::Opcode::FPFloor64:
+            return Join(ir, inst, Floor(ir, arg(0)));
+        case IR::Opcode::FPCeil64:
+            return Join(ir, inst, Ceil(ir, arg(0)));
+        case IR::Opcode::FPTrunc64:
+            return Join(ir, inst, Trunc(ir, arg(0)));
+        case IR::Opcode::FPIsNan64:
+            return inst.ReplaceUsesWith(ir.FPIsNan(arg(0).hi));
+        default:
+            return inst.ReplaceUsesWith(Compare(ir, opcode, arg(0), arg(1)));
+        }
+    }
+
+private:
+    static bool IsLowered(IR::Opcode opcode) {
+        switch (opcode) {
+        case IR::Opcode::SelectF64:
+        case IR::Opcode::FPAbs64:
+        case IR::Opcode::FPNeg64:
+        case IR::Opcode::FPAdd64:
+        case IR::Opcode::FPMul64:
+        case IR::Opcode::FPFma64:
+        case IR::Opcode::FPMin64:
+        case IR::Opcode::FPMax64:
+        case IR::Opcode::FPClamp64:
+        case IR::Opcode::FPSaturate64:
+        case IR::Opcode::FPRecip64:
+        case IR::Opcode::FPRecipSqrt64:
+        case IR::Opcode::FPRoundEven64:
+        case IR::Opcode::FPFloor64:
+        case IR::Opcode::FPCeil64:
+        case IR::Opcode::FPTrunc64:
+        case IR::Opcode::FPIsNan64:
+        case IR::Opcode::FPOrdEqual64:
+        case IR::Opcode::FPUnordEqual64:
+        case IR::Opcode::FPOrdNotEqual64:
+        case IR::Opcode::FPUnordNotEqual64:
+        case IR::Opcode::FPOrdLessThan64:
+        case IR::Opcode::FPUnordLessThan64:
+        case IR::Opcode::FPOrdGreaterThan64:
+        case IR::Opcode::FPUnordGreaterThan64:
+        case IR::Opcode::FPOrdLessThanEqual64:
+        case IR::Opcode::FPUnordLessThanEqual64:
+        case IR::Opcode::FPOrdGreaterThanEqual64:
+        case IR::Opcode::FPUnordGreaterThanEqual64:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool IsPair(const IR::Value& arg) const {
+        const IR::Value value{arg.Resolve()};
+        return !value.IsImmediate() && pairs.contains(value.InstRecursive());
+    }
+
+    struct Joined {
+        DoubleFloat pair;
+        IR::Value words;
+    };
+
+    /// Native joins of lowered instructions, they dominate every use of the original instruction
+    std::unordered_map<const IR::Inst*, Joined> pairs;
+};
+} // Anonymous namespace
+
+void LowerFp64ToFp32Pair(IR::Program& program) {
+    SHADER_TRACE_SCOPE("LowerFp64ToFp32Pair");
+    Lowering lowering;
+    const auto end{program.post_order_blocks.rend()};
+    for (auto it = program.post_order_blocks.rbegin(); it != end; ++it) {
+        IR::Block* const block{*it};
+        for (IR::Inst& inst : block->Instructions()) {
+            lowering.Lower(*block, inst);
+        }
+    }
+}
+
+} // namespace Shader::Optimization
@@ -3,6 +3,7 @@
 
 #include <utility>
 
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/exception.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
 #include <shader_compiler/frontend/ir/ir_emitter.h>
@@ -225,6 +226,7 @@ void Lower(IR::Block& block, IR::Inst& inst) {
 } // Anonymous namespace
 
 void LowerInt64ToInt32(IR::Program& program) {
+    SHADER_TRACE_SCOPE("LowerInt64ToInt32");
     const auto end{program.post_order_blocks.rend()};
     for (auto it = program.post_order_blocks.rbegin(); it != end; ++it) {
         IR::Block* const block{*it};
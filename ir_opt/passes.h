@@ -19,7 +19,9 @@ void GlobalMemoryToStorageBufferPass(IR::Program& program, const HostTranslateIn
 void IdentityRemovalPass(IR::Program& program);
 void LowerFp16ToFp32(IR::Program& program);
 void LowerInt64ToInt32(IR::Program& program);
+void LowerFp64ToFp32Pair(IR::Program& program);
 void RescalingPass(IR::Program& program);
+void SharedAtomicAggregationPass(IR::Program& program);
 void SsaRewritePass(IR::Program& program);
 void PositionPass(Environment& env, IR::Program& program);
 void TexturePass(Environment& env, IR::Program& program, const HostTranslateInfo& host_info);
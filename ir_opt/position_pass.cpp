@@ -3,6 +3,7 @@
 
 #include <boost/container/small_vector.hpp>
 
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
 #include <shader_compiler/frontend/ir/ir_emitter.h>
 #include <shader_compiler/frontend/ir/value.h>
@@ -20,6 +21,7 @@ using PositionInstVector = boost::container::small_vector<PositionInst, 24>;
 } // Anonymous namespace
 
 void PositionPass(Environment& env, IR::Program& program) {
+    SHADER_TRACE_SCOPE("PositionPass");
     if (env.ShaderStage() != Stage::VertexB || env.ReadViewportTransformState()) {
         return;
     }
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <shader_compiler/common/settings.h>
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/environment.h>
 #include <shader_compiler/frontend/ir/ir_emitter.h>
 #include <shader_compiler/frontend/ir/modifiers.h>
@@ -337,6 +338,7 @@ void Visit(const IR::Program& program, IR::Block& block, IR::Inst& inst) {
 } // Anonymous namespace
 
 void RescalingPass(IR::Program& program) {
+    SHADER_TRACE_SCOPE("RescalingPass");
     const bool is_fragment_shader{program.stage == Stage::Fragment};
     if (is_fragment_shader) {
         for (IR::Block* const block : program.post_order_blocks) {
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Marks shared memory atomics to be aggregated per subgroup by the backends. When all active
+// invocations of a subgroup access the same address, the operands are reduced with subgroup
+// arithmetic and a single invocation issues the atomic. Each invocation then gets the previous
+// value combined with the exclusive scan of the operands of the invocations below it, which is
+// what it would have read if the atomics had been issued one after another in invocation order,
+// so results stay bit-exact. Subgroups with divergent addresses take the per-invocation path.
+//
+// Increment, decrement and exchange are not associative in their operand and are left as is.
+
+#include <optional>
+
+#include <shader_compiler/common/trace.h>
+#include <shader_compiler/frontend/ir/basic_block.h>
+#include <shader_compiler/frontend/ir/program.h>
+#include <shader_compiler/frontend/ir/value.h>
+#include <shader_compiler/ir_opt/passes.h>
+
+namespace Shader::Optimization {
+namespace {
+std::optional<IR::Opcode> AggregatedOpcode(IR::Opcode opcode) {
+    switch (opcode) {
+    case IR::Opcode::SharedAtomicIAdd32:
+        return IR::Opcode::SharedAtomicAggregatedIAdd32;
+    case IR::Opcode::SharedAtomicSMin32:
+        return IR::Opcode::SharedAtomicAggregatedSMin32;
+    case IR::Opcode::SharedAtomicUMin32:
+        return IR::Opcode::SharedAtomicAggregatedUMin32;
+    case IR::Opcode::SharedAtomicSMax32:
+        return IR::Opcode::SharedAtomicAggregatedSMax32;
+    case IR::Opcode::SharedAtomicUMax32:
+        return IR::Opcode::SharedAtomicAggregatedUMax32;
+    case IR::Opcode::SharedAtomicAnd32:
+        return IR::Opcode::SharedAtomicAggregatedAnd32;
+    case IR::Opcode::SharedAtomicOr32:
+        return IR::Opcode::SharedAtomicAggregatedOr32;
+    case IR::Opcode::SharedAtomicXor32:
+        return IR::Opcode::SharedAtomicAggregatedXor32;
+    default:
+        return std::nullopt;
+    }
+}
+} // Anonymous namespace
+
+void SharedAtomicAggregationPass(IR::Program& program) {
+    SHADER_TRACE_SCOPE("SharedAtomicAggregationPass");
+    for (IR::Block* const block : program.blocks) {
+        for (IR::Inst& inst : block->Instructions()) {
+            if (const std::optional<IR::Opcode> opcode{AggregatedOpcode(inst.GetOpcode())}) {
+                inst.ReplaceOpcode(*opcode);
+            }
+        }
+    }
+}
+
+} // namespace Shader::Optimization
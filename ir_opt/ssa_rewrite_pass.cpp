@@ -21,6 +21,7 @@
 
 #include <boost/container/flat_map.hpp>
 
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
 #include <shader_compiler/frontend/ir/opcodes.h>
 #include <shader_compiler/frontend/ir/pred.h>
@@ -393,6 +394,7 @@ IR::Type GetConcreteType(IR::Inst* inst) {
 } // Anonymous namespace
 
 void SsaRewritePass(IR::Program& program) {
+    SHADER_TRACE_SCOPE("SsaRewritePass");
     Pass pass;
     const auto end{program.post_order_blocks.rend()};
     for (auto block = program.post_order_blocks.rbegin(); block != end; ++block) {
@@ -8,6 +8,7 @@
 
 #include <boost/container/small_vector.hpp>
 
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/environment.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
 #include <shader_compiler/frontend/ir/breadth_first_search.h>
@@ -328,14 +329,41 @@ std::optional<ConstBufferAddr> TryGetConstBuffer(const IR::Inst* inst, Environme
     };
 }
 
-TextureInst MakeInst(Environment& env, IR::Block* block, IR::Inst& inst) {
+ConstBufferAddr StubBindlessAddr(Environment& env, IR::Inst& inst,
+                                 IR::Diagnostics& diagnostics) {
+    diagnostics.push_back(IR::Diagnostic{
+        .kind = IR::Diagnostic::Kind::UntrackedBindlessHandle,
+        .pc = std::nullopt,
+        .instruction = std::nullopt,
+        .opcode = std::string{NameOf(inst.GetOpcode())},
+        .message = "Failed to track bindless texture constant buffer",
+    });
+    // Fall back to the first handle of the bound texture buffer
+    return ConstBufferAddr{
+        .index = env.TextureBoundBuffer(),
+        .offset = 0,
+        .shift_left = 0,
+        .secondary_index = 0,
+        .secondary_offset = 0,
+        .secondary_shift_left = 0,
+        .dynamic_offset = {},
+        .count = 1,
+        .has_secondary = false,
+    };
+}
+
+TextureInst MakeInst(Environment& env, IR::Block* block, IR::Inst& inst,
+                     IR::Diagnostics* diagnostics) {
     ConstBufferAddr addr;
     if (IsBindless(inst)) {
         const std::optional<ConstBufferAddr> track_addr{Track(inst.Arg(0), env)};
-        if (!track_addr) {
+        if (track_addr) {
+            addr = *track_addr;
+        } else if (diagnostics) {
+            addr = StubBindlessAddr(env, inst, *diagnostics);
+        } else {
             throw NotImplementedException("Failed to track bindless texture constant buffer");
         }
-        addr = *track_addr;
     } else {
         addr = ConstBufferAddr{
             .index = env.TextureBoundBuffer(),
@@ -373,6 +401,21 @@ TexturePixelFormat ReadTexturePixelFormat(Environment& env, const ConstBufferAdd
     return env.ReadTexturePixelFormat(lhs_raw | rhs_raw);
 }
 
+ImageFormat ReadImageFormat(Environment& env, const ConstBufferAddr& cbuf) {
+    const u32 secondary_index{cbuf.has_secondary ? cbuf.secondary_index : cbuf.index};
+    const u32 secondary_offset{cbuf.has_secondary ? cbuf.secondary_offset : cbuf.offset};
+    const u32 lhs_raw{env.ReadCbufValue(cbuf.index, cbuf.offset) << cbuf.shift_left};
+    const u32 rhs_raw{env.ReadCbufValue(secondary_index, secondary_offset)
+                      << cbuf.secondary_shift_left};
+    return env.ReadImageFormat(lhs_raw | rhs_raw);
+}
+
+struct BoundImageFormat {
+    u32 cbuf_index;
+    u32 cbuf_offset;
+    ImageFormat format;
+};
+
 class Descriptors {
 public:
     explicit Descriptors(TextureBufferDescriptors& texture_buffer_descriptors_,
@@ -496,13 +539,16 @@ void PatchTexelFetch(IR::Block& block, IR::Inst& inst, TexturePixelFormat pixel_
 } // Anonymous namespace
 
 void TexturePass(Environment& env, IR::Program& program, const HostTranslateInfo& host_info) {
+    SHADER_TRACE_SCOPE("TexturePass");
+    IR::Diagnostics* const diagnostics{host_info.stub_unimplemented ? &program.diagnostics
+                                                                    : nullptr};
     TextureInstVector to_replace;
     for (IR::Block* const block : program.post_order_blocks) {
         for (IR::Inst& inst : block->Instructions()) {
             if (!IsTextureInstruction(inst)) {
                 continue;
             }
-            to_replace.push_back(MakeInst(env, block, inst));
+            to_replace.push_back(MakeInst(env, block, inst, diagnostics));
         }
     }
     // Sort instructions to visit textures by constant buffer index, then by offset
@@ -518,6 +564,18 @@ void TexturePass(Environment& env, IR::Program& program, const HostTranslateInfo
         program.info.texture_descriptors,
         program.info.image_descriptors,
     };
+    boost::container::small_vector<BoundImageFormat, 4> image_formats;
+    const auto bound_image_format{[&](const ConstBufferAddr& cbuf) {
+        const auto it{ranges::find_if(image_formats, [&cbuf](const BoundImageFormat& bound) {
+            return bound.cbuf_index == cbuf.index && bound.cbuf_offset == cbuf.offset;
+        })};
+        if (it != image_formats.end()) {
+            return it->format;
+        }
+        const ImageFormat format{ReadImageFormat(env, cbuf)};
+        image_formats.push_back({cbuf.index, cbuf.offset, format});
+        return format;
+    }};
     for (TextureInst& texture_inst : to_replace) {
         // TODO: Handle arrays
         IR::Inst* const inst{texture_inst.inst};
@@ -573,6 +631,12 @@ void TexturePass(Environment& env, IR::Program& program, const HostTranslateInfo
             }
             const bool is_written{inst->GetOpcode() != IR::Opcode::ImageRead};
             const bool is_read{inst->GetOpcode() != IR::Opcode::ImageWrite};
+            if (flags.image_format == ImageFormat::Typeless && cbuf.count == 1) {
+                // Formatless storage image accesses are slow on several drivers, use the format
+                // of the bound image when the environment knows it. It's resolved once per handle
+                // and applied to every typeless access, so they keep sharing one descriptor
+                flags.image_format.Assign(bound_image_format(cbuf));
+            }
             if (flags.type == TextureType::Buffer) {
                 index = descriptors.Add(ImageBufferDescriptor{
                     .format = flags.image_format,
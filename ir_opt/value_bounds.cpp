@@ -0,0 +1,280 @@
+// SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <optional>
+
+#include <shader_compiler/frontend/ir/value.h>
+#include <shader_compiler/ir_opt/value_bounds.h>
+#include <shader_compiler/shader_info.h>
+
+namespace Shader::Optimization {
+namespace {
+/// Depth limit of the offset analysis, this also bounds the walk around loop phis
+constexpr u32 MAX_OFFSET_ANALYSIS_DEPTH{8};
+
+std::optional<u32> Narrow(u64 value) {
+    if (value > std::numeric_limits<u32>::max()) {
+        return std::nullopt;
+    }
+    return static_cast<u32>(value);
+}
+
+std::optional<u32> UpperBound(const IR::Value& value, u32 depth) {
+    if (value.IsImmediate()) {
+        return value.U32();
+    }
+    if (depth >= MAX_OFFSET_ANALYSIS_DEPTH) {
+        return std::nullopt;
+    }
+    IR::Inst* const inst{value.InstRecursive()};
+    const auto bound{[&](size_t index) { return UpperBound(inst->Arg(index), depth + 1); }};
+    const auto signed_bound{[&](size_t index) -> std::optional<u32> {
+        // Signed and unsigned operations agree when the sign bit is known to be clear
+        const std::optional<u32> result{bound(index)};
+        if (!result || *result > static_cast<u32>(std::numeric_limits<s32>::max())) {
+            return std::nullopt;
+        }
+        return result;
+    }};
+    switch (inst->GetOpcode()) {
+    case IR::Opcode::Phi: {
+        u32 result{};
+        for (size_t arg = 0; arg < inst->NumArgs(); ++arg) {
+            const std::optional<u32> arg_bound{bound(arg)};
+            if (!arg_bound) {
+                return std::nullopt;
+            }
+            result = std::max(result, *arg_bound);
+        }
+        return result;
+    }
+    case IR::Opcode::IAdd32: {
+        const std::optional<u32> lhs{bound(0)};
+        const std::optional<u32> rhs{bound(1)};
+        if (!lhs || !rhs) {
+            return std::nullopt;
+        }
+        return Narrow(u64{*lhs} + u64{*rhs});
+    }
+    case IR::Opcode::IMul32: {
+        const std::optional<u32> lhs{bound(0)};
+        const std::optional<u32> rhs{bound(1)};
+        if (!lhs || !rhs) {
+            return std::nullopt;
+        }
+        return Narrow(u64{*lhs} * u64{*rhs});
+    }
+    case IR::Opcode::ShiftLeftLogical32: {
+        const std::optional<u32> base{bound(0)};
+        if (!base || !inst->Arg(1).IsImmediate() || inst->Arg(1).U32() >= 32) {
+            return std::nullopt;
+        }
+        return Narrow(u64{*base} << inst->Arg(1).U32());
+    }
+    case IR::Opcode::ShiftRightLogical32: {
+        const std::optional<u32> base{bound(0)};
+        if (!base) {
+            return std::nullopt;
+        }
+        if (!inst->Arg(1).IsImmediate()) {
+            return base;
+        }
+        return inst->Arg(1).U32() >= 32 ? 0 : *base >> inst->Arg(1).U32();
+    }
+    case IR::Opcode::ShiftRightArithmetic32: {
+        const std::optional<u32> base{signed_bound(0)};
+        if (!base || !inst->Arg(1).IsImmediate()) {
+            return base;
+        }
+        return inst->Arg(1).U32() >= 32 ? 0 : *base >> inst->Arg(1).U32();
+    }
+    case IR::Opcode::BitwiseAnd32: {
+        const std::optional<u32> lhs{bound(0)};
+        const std::optional<u32> rhs{bound(1)};
+        if (lhs && rhs) {
+            return std::min(*lhs, *rhs);
+        }
+        return lhs ? lhs : rhs;
+    }
+    case IR::Opcode::BitwiseOr32: {
+        const std::optional<u32> lhs{bound(0)};
+        const std::optional<u32> rhs{bound(1)};
+        if (!lhs || !rhs) {
+            return std::nullopt;
+        }
+        // No bits above the highest set bit of either operand can be set
+        const u32 width{static_cast<u32>(std::bit_width(std::max(*lhs, *rhs)))};
+        return width >= 32 ? std::numeric_limits<u32>::max() : (1U << width) - 1;
+    }
+    case IR::Opcode::BitFieldUExtract: {
+        if (!inst->Arg(2).IsImmediate() || inst->Arg(2).U32() >= 32) {
+            return std::nullopt;
+        }
+        return (1U << inst->Arg(2).U32()) - 1;
+    }
+    case IR::Opcode::UMin32: {
+        const std::optional<u32> lhs{bound(0)};
+        const std::optional<u32> rhs{bound(1)};
+        if (lhs && rhs) {
+            return std::min(*lhs, *rhs);
+        }
+        return lhs ? lhs : rhs;
+    }
+    case IR::Opcode::UMax32: {
+        const std::optional<u32> lhs{bound(0)};
+        const std::optional<u32> rhs{bound(1)};
+        if (!lhs || !rhs) {
+            return std::nullopt;
+        }
+        return std::max(*lhs, *rhs);
+    }
+    case IR::Opcode::SMin32: {
+        const std::optional<u32> lhs{signed_bound(0)};
+        const std::optional<u32> rhs{signed_bound(1)};
+        if (!lhs || !rhs) {
+            return std::nullopt;
+        }
+        return std::min(*lhs, *rhs);
+    }
+    case IR::Opcode::SMax32: {
+        const std::optional<u32> lhs{signed_bound(0)};
+        const std::optional<u32> rhs{signed_bound(1)};
+        if (!lhs || !rhs) {
+            return std::nullopt;
+        }
+        return std::max(*lhs, *rhs);
+    }
+    case IR::Opcode::UClamp32:
+        return bound(2);
+    case IR::Opcode::SClamp32: {
+        // A non-negative lower limit keeps the result within [min, max]
+        const IR::Value min{inst->Arg(1)};
+        const IR::Value max{inst->Arg(2)};
+        if (!min.IsImmediate() || !max.IsImmediate() || static_cast<s32>(min.U32()) < 0 ||
+            static_cast<s32>(min.U32()) > static_cast<s32>(max.U32())) {
+            return std::nullopt;
+        }
+        return max.U32();
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+constexpr u32 ALL_INDIRECT_CBUFS{(1U << Info::MAX_INDIRECT_CBUFS) - 1};
+
+/// Set of values below 32 represented as a bit mask
+using ValueSet = u32;
+
+template <typename Func>
+std::optional<ValueSet> CombineSets(ValueSet lhs, ValueSet rhs, Func&& func) {
+    ValueSet result{};
+    for (u32 a = 0; a < 32; ++a) {
+        if (((lhs >> a) & 1) == 0) {
+            continue;
+        }
+        for (u32 b = 0; b < 32; ++b) {
+            if (((rhs >> b) & 1) == 0) {
+                continue;
+            }
+            const u32 value{func(a, b)};
+            if (value >= 32) {
+                return std::nullopt;
+            }
+            result |= 1U << value;
+        }
+    }
+    return result;
+}
+
+/// Returns the set of values a small unsigned integer can take, if it can be proven
+std::optional<ValueSet> PossibleValues(const IR::Value& value, u32 depth = 0) {
+    if (value.IsImmediate()) {
+        if (value.U32() >= 32) {
+            return std::nullopt;
+        }
+        return ValueSet{1U << value.U32()};
+    }
+    if (depth >= MAX_OFFSET_ANALYSIS_DEPTH) {
+        return std::nullopt;
+    }
+    IR::Inst* const inst{value.InstRecursive()};
+    const auto values{[&](size_t index) { return PossibleValues(inst->Arg(index), depth + 1); }};
+    const auto combine{[&](auto&& func) -> std::optional<ValueSet> {
+        const std::optional<ValueSet> lhs{values(0)};
+        const std::optional<ValueSet> rhs{values(1)};
+        if (!lhs || !rhs) {
+            return std::nullopt;
+        }
+        return CombineSets(*lhs, *rhs, func);
+    }};
+    std::optional<ValueSet> result;
+    switch (inst->GetOpcode()) {
+    case IR::Opcode::Phi: {
+        ValueSet phi_set{};
+        for (size_t arg = 0; arg < inst->NumArgs(); ++arg) {
+            const std::optional<ValueSet> arg_set{values(arg)};
+            if (!arg_set) {
+                return std::nullopt;
+            }
+            phi_set |= *arg_set;
+        }
+        return phi_set;
+    }
+    case IR::Opcode::SelectU32: {
+        const std::optional<ValueSet> true_set{PossibleValues(inst->Arg(1), depth + 1)};
+        const std::optional<ValueSet> false_set{PossibleValues(inst->Arg(2), depth + 1)};
+        if (true_set && false_set) {
+            return *true_set | *false_set;
+        }
+        break;
+    }
+    case IR::Opcode::IAdd32:
+        result = combine([](u32 a, u32 b) { return a + b; });
+        break;
+    case IR::Opcode::BitwiseAnd32:
+        result = combine([](u32 a, u32 b) { return a & b; });
+        break;
+    case IR::Opcode::BitwiseOr32:
+        result = combine([](u32 a, u32 b) { return a | b; });
+        break;
+    case IR::Opcode::ShiftLeftLogical32:
+        result = combine([](u32 a, u32 b) { return b >= 32 ? 0 : a << b; });
+        break;
+    case IR::Opcode::ShiftRightLogical32:
+        result = combine([](u32 a, u32 b) { return b >= 32 ? 0 : a >> b; });
+        break;
+    default:
+        break;
+    }
+    if (result) {
+        return result;
+    }
+    // Fall back to the range below the upper bound of the value
+    const std::optional<u32> bound{UpperBound(value, depth)};
+    if (!bound || *bound >= 32) {
+        return std::nullopt;
+    }
+    return static_cast<ValueSet>((u64{1} << (*bound + 1)) - 1);
+}
+
+} // Anonymous namespace
+
+std::optional<u32> UpperBound(const IR::Value& value) {
+    return UpperBound(value, 0);
+}
+
+u32 ReachableIndirectCbufs(const IR::Value& index) {
+    const std::optional<ValueSet> values{PossibleValues(index)};
+    if (!values) {
+        return ALL_INDIRECT_CBUFS;
+    }
+    // Backends read the first bank for indices past the indirectly accessible ones
+    const bool out_of_range{(*values & ~ALL_INDIRECT_CBUFS) != 0};
+    return (*values & ALL_INDIRECT_CBUFS) | (out_of_range ? 1U : 0U);
+}
+
+} // namespace Shader::Optimization
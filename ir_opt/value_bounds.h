@@ -0,0 +1,20 @@
+// SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+
+#include <shader_compiler/common/common_types.h>
+#include <shader_compiler/frontend/ir/value.h>
+
+namespace Shader::Optimization {
+
+/// Returns an inclusive upper bound of the unsigned value, if one can be proven
+[[nodiscard]] std::optional<u32> UpperBound(const IR::Value& value);
+
+/// Returns the mask of constant buffers a register indexed read can access, indices past the
+/// indirectly accessible banks read the first one
+[[nodiscard]] u32 ReachableIndirectCbufs(const IR::Value& index);
+
+} // namespace Shader::Optimization
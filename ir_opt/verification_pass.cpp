@@ -4,6 +4,7 @@
 #include <map>
 #include <set>
 
+#include <shader_compiler/common/trace.h>
 #include <shader_compiler/exception.h>
 #include <shader_compiler/frontend/ir/basic_block.h>
 #include <shader_compiler/frontend/ir/value.h>
@@ -88,6 +89,7 @@ static void ValidatePhiNodes(const IR::Program& program) {
 }
 
 void VerificationPass(const IR::Program& program) {
+    SHADER_TRACE_SCOPE("VerificationPass");
     ValidateTypes(program);
     ValidateUses(program);
     ValidateForwardDeclarations(program);
@@ -7,6 +7,8 @@
 #include <type_traits>
 #include <utility>
 
+#include <shader_compiler/common/allocation_stats.h>
+
 namespace Shader {
 
 template <typename T>
@@ -57,7 +59,9 @@ private:
     struct Chunk {
         explicit Chunk() = default;
         explicit Chunk(size_t size)
-            : num_objects{size}, storage{std::make_unique<Storage[]>(size)} {}
+            : num_objects{size}, storage{std::make_unique<Storage[]>(size)} {
+            Allocation::Record(size * sizeof(Storage));
+        }
 
         Chunk& operator=(Chunk&& rhs) noexcept {
             Release();
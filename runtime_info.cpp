@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <range/v3/algorithm.hpp>
+#include <algorithm>
+
+#include <shader_compiler/common/hash.h>
+#include <shader_compiler/runtime_info.h>
+
+namespace Shader {
+
+const TransformFeedbackOutput* TransformFeedbackLayout::Find(
+    IR::Attribute attribute) const noexcept {
+    const auto it{ranges::lower_bound(outputs, attribute, {}, &TransformFeedbackOutput::attribute)};
+    return it != outputs.end() && it->attribute == attribute ? &*it : nullptr;
+}
+
+TransformFeedbackLayout MakeTransformFeedbackLayout(
+    std::span<const TransformFeedbackVarying> varyings) {
+    TransformFeedbackLayout layout;
+    size_t index{0};
+    while (index < varyings.size()) {
+        const TransformFeedbackVarying& varying{varyings[index]};
+        if (varying.components == 0) {
+            ++index;
+            continue;
+        }
+        // Outputs can't cross a location
+        const u32 components{std::min(varying.components, static_cast<u32>(4 - index % 4))};
+        TransformFeedbackOutput* const last{layout.outputs.empty() ? nullptr
+                                                                   : &layout.outputs.back()};
+        const size_t last_end{last ? static_cast<size_t>(last->attribute) + last->components : 0};
+        if (last && last_end == index && index % 4 != 0 && last->buffer == varying.buffer &&
+            last->stride == varying.stride &&
+            last->offset + last->components * 4 == varying.offset) {
+            last->components += components;
+        } else {
+            layout.outputs.push_back({
+                .attribute = static_cast<IR::Attribute>(index),
+                .components = components,
+                .buffer = varying.buffer,
+                .stride = varying.stride,
+                .offset = varying.offset,
+            });
+        }
+        index += components;
+    }
+    boost::container::small_vector<u64, 24> words;
+    for (const TransformFeedbackOutput& output : layout.outputs) {
+        words.push_back((static_cast<u64>(output.attribute) << 32) | output.components);
+        words.push_back((static_cast<u64>(output.buffer) << 32) | output.stride);
+        words.push_back(output.offset);
+    }
+    layout.hash = HashWords({words.data(), words.size()});
+    return layout;
+}
+
+} // namespace Shader
@@ -4,9 +4,10 @@
 #pragma once
 
 #include <array>
-#include <map>
 #include <optional>
-#include <vector>
+#include <span>
+
+#include <boost/container/small_vector.hpp>
 
 #include <shader_compiler/common/common_types.h>
 #include <shader_compiler/varying_state.h>
@@ -60,10 +61,44 @@ struct TransformFeedbackVarying {
     u32 components{};
 };
 
+/// Transform feedback output covering consecutive components of a single location
+struct TransformFeedbackOutput {
+    IR::Attribute attribute{}; ///< First component of the output
+    u32 components{};
+    u32 buffer{};
+    u32 stride{};
+    u32 offset{};
+
+    auto operator<=>(const TransformFeedbackOutput&) const = default;
+};
+
+/// Compact transform feedback state, built once per state and shared by every stage using it
+struct TransformFeedbackLayout {
+    /// Sorted by attribute, components contiguous in both the location and the buffer are merged
+    boost::container::small_vector<TransformFeedbackOutput, 8> outputs;
+    /// Hash of the outputs, computed when the layout is built
+    u64 hash{};
+
+    /// Returns the output starting at the given attribute, if any
+    [[nodiscard]] const TransformFeedbackOutput* Find(IR::Attribute attribute) const noexcept;
+
+    [[nodiscard]] bool Empty() const noexcept {
+        return outputs.empty();
+    }
+
+    [[nodiscard]] bool operator==(const TransformFeedbackLayout& rhs) const noexcept {
+        return hash == rhs.hash && outputs == rhs.outputs;
+    }
+};
+
+/// Builds the layout out of per attribute varyings, where entries with zero components are unused
+[[nodiscard]] TransformFeedbackLayout MakeTransformFeedbackLayout(
+    std::span<const TransformFeedbackVarying> varyings);
+
 struct RuntimeInfo {
     std::array<AttributeType, 32> generic_input_types{};
     VaryingState previous_stage_stores;
-    std::map<IR::Attribute, IR::Attribute> previous_stage_legacy_stores_mapping;
+    IR::AttributeMapping previous_stage_legacy_stores_mapping;
 
     bool convert_depth_mode{};
     bool force_early_z{};
@@ -83,8 +118,10 @@ struct RuntimeInfo {
     /// Use storage buffers instead of global pointers on GLASM
     bool glasm_use_storage_buffers{};
 
-    /// Transform feedback state for each varying
-    std::vector<TransformFeedbackVarying> xfb_varyings;
+    /// Transform feedback state, see MakeTransformFeedbackLayout
+    TransformFeedbackLayout xfb_layout;
+
+    [[nodiscard]] bool operator==(const RuntimeInfo&) const = default;
 };
 
 } // namespace Shader
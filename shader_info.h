@@ -5,7 +5,6 @@
 
 #include <array>
 #include <bitset>
-#include <map>
 
 #include <shader_compiler/common/common_types.h>
 #include <shader_compiler/frontend/ir/type.h>
@@ -69,6 +68,15 @@ struct ConstantBufferDescriptor {
     auto operator<=>(const ConstantBufferDescriptor&) const = default;
 };
 
+/// Constant buffer word the program was specialized for, see Environment::GetCbufAssumption
+struct CbufAssumption {
+    u32 bank;
+    u32 offset;
+    u32 value;
+
+    auto operator<=>(const CbufAssumption&) const = default;
+};
+
 struct StorageBufferDescriptor {
     u32 cbuf_index;
     u32 cbuf_offset;
@@ -137,92 +145,108 @@ struct ImageDescriptor {
 };
 using ImageDescriptors = boost::container::small_vector<ImageDescriptor, 4>;
 
+// Flags are packed into bitfields, the serializer in info_serialization.cpp has to be updated
+// together with any change to the members
 struct Info {
     static constexpr size_t MAX_INDIRECT_CBUFS{14};
     static constexpr size_t MAX_CBUFS{18};
     static constexpr size_t MAX_SSBOS{32};
 
-    bool uses_workgroup_id{};
-    bool uses_local_invocation_id{};
-    bool uses_invocation_id{};
-    bool uses_invocation_info{};
-    bool uses_sample_id{};
-    bool uses_is_helper_invocation{};
-    bool uses_subgroup_invocation_id{};
-    bool uses_subgroup_shuffles{};
-    std::array<bool, 30> uses_patches{};
+    bool uses_workgroup_id : 1 {};
+    bool uses_local_invocation_id : 1 {};
+    bool uses_invocation_id : 1 {};
+    bool uses_invocation_info : 1 {};
+    bool uses_sample_id : 1 {};
+    bool uses_is_helper_invocation : 1 {};
+    bool uses_subgroup_invocation_id : 1 {};
+    bool uses_subgroup_shuffles : 1 {};
+    std::bitset<30> uses_patches{};
 
     std::array<Interpolation, 32> interpolation{};
     VaryingState loads;
     VaryingState stores;
     VaryingState passthrough;
 
-    std::map<IR::Attribute, IR::Attribute> legacy_stores_mapping;
-
-    bool loads_indexed_attributes{};
-
-    std::array<bool, 8> stores_frag_color{};
-    bool stores_sample_mask{};
-    bool stores_frag_depth{};
-
-    bool stores_tess_level_outer{};
-    bool stores_tess_level_inner{};
-
-    bool stores_indexed_attributes{};
-
-    bool stores_global_memory{};
-
-    bool uses_fp16{};
-    bool uses_fp64{};
-    bool uses_fp16_denorms_flush{};
-    bool uses_fp16_denorms_preserve{};
-    bool uses_fp32_denorms_flush{};
-    bool uses_fp32_denorms_preserve{};
-    bool uses_int8{};
-    bool uses_int16{};
-    bool uses_int64{};
-    bool uses_image_1d{};
-    bool uses_sampled_1d{};
-    bool uses_sparse_residency{};
-    bool uses_demote_to_helper_invocation{};
-    bool uses_subgroup_vote{};
-    bool uses_subgroup_mask{};
-    bool uses_fswzadd{};
-    bool uses_derivatives{};
-    bool uses_typeless_image_reads{};
-    bool uses_typeless_image_writes{};
-    bool uses_image_buffers{};
-    bool uses_shared_increment{};
-    bool uses_shared_decrement{};
-    bool uses_global_increment{};
-    bool uses_global_decrement{};
-    bool uses_atomic_f32_add{};
-    bool uses_atomic_f16x2_add{};
-    bool uses_atomic_f16x2_min{};
-    bool uses_atomic_f16x2_max{};
-    bool uses_atomic_f32x2_add{};
-    bool uses_atomic_f32x2_min{};
-    bool uses_atomic_f32x2_max{};
-    bool uses_atomic_s32_min{};
-    bool uses_atomic_s32_max{};
-    bool uses_int64_bit_atomics{};
-    bool uses_global_memory{};
-    bool uses_atomic_image_u32{};
-    bool uses_shadow_lod{};
-    bool uses_rescaling_uniform{};
-    bool uses_cbuf_indirect{};
-    bool uses_render_area{};
+    IR::AttributeMapping legacy_stores_mapping;
+
+    bool loads_indexed_attributes : 1 {};
+
+    std::bitset<8> stores_frag_color{};
+    bool stores_sample_mask : 1 {};
+    bool stores_frag_depth : 1 {};
+
+    bool stores_tess_level_outer : 1 {};
+    bool stores_tess_level_inner : 1 {};
+
+    bool stores_indexed_attributes : 1 {};
+
+    bool stores_global_memory : 1 {};
+
+    bool uses_fp16 : 1 {};
+    bool uses_fp64 : 1 {};
+    bool uses_fp16_denorms_flush : 1 {};
+    bool uses_fp16_denorms_preserve : 1 {};
+    bool uses_fp32_denorms_flush : 1 {};
+    bool uses_fp32_denorms_preserve : 1 {};
+    bool uses_int8 : 1 {};
+    bool uses_int16 : 1 {};
+    bool uses_int64 : 1 {};
+    bool uses_image_1d : 1 {};
+    bool uses_sampled_1d : 1 {};
+    bool uses_sparse_residency : 1 {};
+    bool uses_demote_to_helper_invocation : 1 {};
+    bool uses_subgroup_vote : 1 {};
+    bool uses_subgroup_mask : 1 {};
+    bool uses_fswzadd : 1 {};
+    bool uses_derivatives : 1 {};
+    bool uses_typeless_image_reads : 1 {};
+    bool uses_typeless_image_writes : 1 {};
+    bool uses_image_buffers : 1 {};
+    bool uses_shared_increment : 1 {};
+    bool uses_shared_decrement : 1 {};
+    bool uses_shared_atomic_aggregation : 1 {};
+    bool uses_shared_aggregated_iadd : 1 {};
+    bool uses_shared_aggregated_smin : 1 {};
+    bool uses_shared_aggregated_umin : 1 {};
+    bool uses_shared_aggregated_smax : 1 {};
+    bool uses_shared_aggregated_umax : 1 {};
+    bool uses_shared_aggregated_and : 1 {};
+    bool uses_shared_aggregated_or : 1 {};
+    bool uses_shared_aggregated_xor : 1 {};
+    bool uses_global_increment : 1 {};
+    bool uses_global_decrement : 1 {};
+    bool uses_atomic_f32_add : 1 {};
+    bool uses_atomic_f16x2_add : 1 {};
+    bool uses_atomic_f16x2_min : 1 {};
+    bool uses_atomic_f16x2_max : 1 {};
+    bool uses_atomic_f32x2_add : 1 {};
+    bool uses_atomic_f32x2_min : 1 {};
+    bool uses_atomic_f32x2_max : 1 {};
+    bool uses_atomic_s32_min : 1 {};
+    bool uses_atomic_s32_max : 1 {};
+    bool uses_int64_bit_atomics : 1 {};
+    bool uses_global_memory : 1 {};
+    bool uses_atomic_image_u32 : 1 {};
+    bool uses_shadow_lod : 1 {};
+    bool uses_rescaling_uniform : 1 {};
+    bool uses_cbuf_indirect : 1 {};
+    bool uses_render_area : 1 {};
 
     IR::Type used_constant_buffer_types{};
     IR::Type used_storage_buffer_types{};
     IR::Type used_indirect_cbuf_types{};
 
     u32 constant_buffer_mask{};
+    /// Banks reachable from register indexed constant buffer reads
+    u32 indirect_constant_buffer_mask{};
     std::array<u32, MAX_CBUFS> constant_buffer_used_sizes{};
     u32 nvn_buffer_base{};
     std::bitset<16> nvn_buffer_used{};
+    /// Sorted assumptions that were folded into the program, the embedder must only use the
+    /// program while all of them hold
+    boost::container::small_vector<CbufAssumption, 4> cbuf_assumptions;
 
-    bool requires_layer_emulation{};
+    bool requires_layer_emulation : 1 {};
     IR::Attribute emulated_layer{};
 
     boost::container::static_vector<ConstantBufferDescriptor, MAX_CBUFS>
@@ -232,6 +256,8 @@ struct Info {
     ImageBufferDescriptors image_buffer_descriptors;
     TextureDescriptors texture_descriptors;
     ImageDescriptors image_descriptors;
+
+    [[nodiscard]] bool operator==(const Info&) const = default;
 };
 
 template <typename Descriptors>